@@ -40,6 +40,8 @@
  *
  * @note Ensure proper hardware connections and pin configurations before calling this function.
  *       This function might involve specific timing requirements or initial setup procedures that need to be met.
+ * @note With the SCB reset service enabled, a warm reset skips the 30 ms power-up delay (the display stayed powered);
+ *       in 8-bit mode the command sequence is skipped as well and the previous display content is kept.
  *
  * @par Example:
  *      To initialize the connected LCD module, use the following code:
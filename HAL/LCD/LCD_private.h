@@ -19,4 +19,8 @@
 #define LCD_MODE_8_BIT			0
 #define LCD_MODE_4_BIT			1
 
+/* Masks of the data lines inside LCD_DATA_PORT, used to drive the whole bus with one BSRR store */
+#define LCD_DATA_4BIT_MASK		( (u16)( (1U << LCD_D4_PIN) | (1U << LCD_D5_PIN) | (1U << LCD_D6_PIN) | (1U << LCD_D7_PIN) ) )
+#define LCD_DATA_8BIT_MASK		( (u16)( (1U << LCD_D0_PIN) | (1U << LCD_D1_PIN) | (1U << LCD_D2_PIN) | (1U << LCD_D3_PIN) | LCD_DATA_4BIT_MASK ) )
+
 #endif /* LCD_PRIVATE_H_ */
\ No newline at end of file
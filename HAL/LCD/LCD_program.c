@@ -21,10 +21,67 @@
 #include "RCC_interface.h"
 #include "SYSTICK_interface.h"
 #include "GPIO_interface.h"
+#include "SCB_interface.h"
 /**************************************** HAL *****************************************************/
 #include "LCD_interface.h"
 #include "LCD_private.h"
 #include "LCD_config.h"
+/**************************************** Global Var *****************************************************/
+/* Pin map of the LCD, applied in one pass by MCAL_GPIO_ApplyConfigTable */
+#if LCD_MODE == LCD_MODE_8_BIT
+static const GPIO_PinCfg_t LCD_PinCfgTable[] =
+{
+    { LCD_CONTROL_PORT, LCD_RS_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_CONTROL_PORT, LCD_RW_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_CONTROL_PORT, LCD_E_PIN,  GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D0_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D1_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D2_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D3_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D4_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D5_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D6_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D7_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+};
+#elif LCD_MODE == LCD_MODE_4_BIT
+static const GPIO_PinCfg_t LCD_PinCfgTable[] =
+{
+    { LCD_CONTROL_PORT, LCD_RS_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_CONTROL_PORT, LCD_E_PIN,  GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D4_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D5_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D6_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+    { LCD_DATA_PORT,    LCD_D7_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW },
+};
+#endif
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Spreads a data byte over the configured data pins.
+ *
+ * @param[in] Copy_Data The byte to place on the bus. In 4-bit mode only the low nibble is used and it lands on D4..D7.
+ * @retval u16 The port image of the data lines, to be written with LCD_DATA_xBIT_MASK.
+ */
+static u16 LCD_u16MapDataBus(u8 Copy_Data)
+{
+    u16 Local_PortValue = 0;
+    #if LCD_MODE == LCD_MODE_8_BIT
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 0) << LCD_D0_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 1) << LCD_D1_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 2) << LCD_D2_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 3) << LCD_D3_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 4) << LCD_D4_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 5) << LCD_D5_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 6) << LCD_D6_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 7) << LCD_D7_PIN);
+    #elif LCD_MODE == LCD_MODE_4_BIT
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 0) << LCD_D4_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 1) << LCD_D5_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 2) << LCD_D6_PIN);
+        Local_PortValue |= (u16)(GET_BIT(Copy_Data, 3) << LCD_D7_PIN);
+    #endif
+    return Local_PortValue;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
 /**
  * @brief Initializes the LCD driver based on the configured mode (8-bit or 4-bit).
@@ -35,54 +92,54 @@ Std_ReturnType LCD_Init(void){
     // Variable to track the function status, initially set to E_NOT_OK
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
 
+    // Warm flags kept over a warm reset; stays 0 after a cold start or without the SCB reset service
+    u32 Local_WarmFlags = 0;
+
     // Initialize the system tick timer
     MCAL_SYSTICK_vINIT();
+    MCAL_SCB_GetWarmFlags(&Local_WarmFlags);
 
     // Check the configured LCD mode and initialize accordingly
     #if LCD_MODE == LCD_MODE_8_BIT
         // Set control pins and data pins for 8-bit mode
-        MCAL_GPIO_SetPinMode(LCD_CONTROL_PORT, LCD_RS_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D0_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D1_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D2_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D3_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D4_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D5_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D6_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D7_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-
-        // Delay for LCD startup (30ms)
-        MCAL_SYSTICK_DelayMS(30);
-
-        // LCD initialization sequence for 8-bit mode
-        LCD_SendCmnd(LCD_HOME);
-        MCAL_SYSTICK_DelayMS(1);
-        LCD_SendCmnd(LCD_FUNCTIONSET8BIT);
-        MCAL_SYSTICK_DelayMS(1);
-        LCD_SendCmnd(LCD_DISPLAYON);
-        MCAL_SYSTICK_DelayMS(1);
-        LCD_SendCmnd(LCD_CLEAR);
-        MCAL_SYSTICK_DelayMS(1);
-        LCD_SendCmnd(LCD_ENTRYMODE);
-        MCAL_SYSTICK_DelayMS(1);
+        MCAL_GPIO_ApplyConfigTable(LCD_PinCfgTable, sizeof(LCD_PinCfgTable) / sizeof(LCD_PinCfgTable[0]));
+
+        // After a warm reset the controller kept its power and configuration: only the MCU pins needed setting up
+        if ((Local_WarmFlags & SCB_WARM_LCD_READY) == 0)
+        {
+            // Delay for LCD startup (30ms)
+            MCAL_SYSTICK_DelayMS(30);
+
+            // LCD initialization sequence for 8-bit mode
+            LCD_SendCmnd(LCD_HOME);
+            MCAL_SYSTICK_DelayMS(1);
+            LCD_SendCmnd(LCD_FUNCTIONSET8BIT);
+            MCAL_SYSTICK_DelayMS(1);
+            LCD_SendCmnd(LCD_DISPLAYON);
+            MCAL_SYSTICK_DelayMS(1);
+            LCD_SendCmnd(LCD_CLEAR);
+            MCAL_SYSTICK_DelayMS(1);
+            LCD_SendCmnd(LCD_ENTRYMODE);
+            MCAL_SYSTICK_DelayMS(1);
+
+            MCAL_SCB_SetWarmFlags(SCB_WARM_LCD_READY);
+        }
 
         // Update function status to indicate successful initialization
         Local_FunctionStatus = E_OK;
 
     #elif LCD_MODE == LCD_MODE_4_BIT
         // Set control pins and data pins for 4-bit mode
-        MCAL_GPIO_SetPinMode(LCD_CONTROL_PORT, LCD_RS_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D4_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D5_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D6_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
-        MCAL_GPIO_SetPinMode(LCD_DATA_PORT, LCD_D7_PIN, GPIO_OUTPUT_LOW_SPEED_PUSHPULL);
+        MCAL_GPIO_ApplyConfigTable(LCD_PinCfgTable, sizeof(LCD_PinCfgTable) / sizeof(LCD_PinCfgTable[0]));
 
-        // Delay for LCD startup (30ms)
-        MCAL_SYSTICK_DelayMS(30);
+        // Delay for LCD startup (30ms), not needed when the controller stayed powered over a warm reset
+        if ((Local_WarmFlags & SCB_WARM_LCD_READY) == 0)
+        {
+            MCAL_SYSTICK_DelayMS(30);
+        }
 
-        // LCD initialization sequence for 4-bit mode
+        // LCD initialization sequence for 4-bit mode, always sent: a reset in the middle of a byte leaves the
+        // controller waiting for its second nibble, and this sequence brings the nibbles back in step
         LCD_SendCmnd(LCD_HOME);
         MCAL_SYSTICK_DelayMS(1);
         LCD_SendCmnd(LCD_FUNCTIONSET4BIT);
@@ -94,6 +151,8 @@ Std_ReturnType LCD_Init(void){
         LCD_SendCmnd(LCD_ENTRYMODE);
         MCAL_SYSTICK_DelayMS(1);
 
+        MCAL_SCB_SetWarmFlags(SCB_WARM_LCD_READY);
+
         // Update function status to indicate successful initialization
         Local_FunctionStatus = E_OK;
 
@@ -124,14 +183,7 @@ Std_ReturnType LCD_SendCmnd(u8 Copy_Cmnd)
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_RW_PIN, GPIO_LOW);
 
         // Set data pins with bits from the command
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D7_PIN, GET_BIT(Copy_Cmnd, 7));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D6_PIN, GET_BIT(Copy_Cmnd, 6));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D5_PIN, GET_BIT(Copy_Cmnd, 5));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D4_PIN, GET_BIT(Copy_Cmnd, 4));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D3_PIN, GET_BIT(Copy_Cmnd, 3));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D2_PIN, GET_BIT(Copy_Cmnd, 2));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D1_PIN, GET_BIT(Copy_Cmnd, 1));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D0_PIN, GET_BIT(Copy_Cmnd, 0));
+        MCAL_GPIO_SetPortValueMasked(LCD_DATA_PORT, LCD_DATA_8BIT_MASK, LCD_u16MapDataBus(Copy_Cmnd));
 
         // Pulse the E pin to send the command
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_HIGH);
@@ -146,10 +198,7 @@ Std_ReturnType LCD_SendCmnd(u8 Copy_Cmnd)
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_RS_PIN, GPIO_LOW);
 
         // Set data pins with higher nibble of the command
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D7_PIN, GET_BIT(Copy_Cmnd, 7));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D6_PIN, GET_BIT(Copy_Cmnd, 6));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D5_PIN, GET_BIT(Copy_Cmnd, 5));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D4_PIN, GET_BIT(Copy_Cmnd, 4));
+        MCAL_GPIO_SetPortValueMasked(LCD_DATA_PORT, LCD_DATA_4BIT_MASK, LCD_u16MapDataBus(Copy_Cmnd >> 4));
 
         // Pulse the E pin to send higher nibble of the command
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_HIGH);
@@ -157,10 +206,7 @@ Std_ReturnType LCD_SendCmnd(u8 Copy_Cmnd)
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_LOW);
 
         // Set data pins with lower nibble of the command
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D7_PIN, GET_BIT(Copy_Cmnd, 3));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D6_PIN, GET_BIT(Copy_Cmnd, 2));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D5_PIN, GET_BIT(Copy_Cmnd, 1));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D4_PIN, GET_BIT(Copy_Cmnd, 0));
+        MCAL_GPIO_SetPortValueMasked(LCD_DATA_PORT, LCD_DATA_4BIT_MASK, LCD_u16MapDataBus(Copy_Cmnd & 0x0F));
 
         // Pulse the E pin to send lower nibble of the command
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_HIGH);
@@ -197,14 +243,7 @@ Std_ReturnType LCD_SendChar(u8 Copy_Data)
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_RW_PIN, GPIO_LOW);
 
         // Set data pins with bits from the character
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D7_PIN, GET_BIT(Copy_Data, 7));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D6_PIN, GET_BIT(Copy_Data, 6));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D5_PIN, GET_BIT(Copy_Data, 5));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D4_PIN, GET_BIT(Copy_Data, 4));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D3_PIN, GET_BIT(Copy_Data, 3));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D2_PIN, GET_BIT(Copy_Data, 2));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D1_PIN, GET_BIT(Copy_Data, 1));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D0_PIN, GET_BIT(Copy_Data, 0));
+        MCAL_GPIO_SetPortValueMasked(LCD_DATA_PORT, LCD_DATA_8BIT_MASK, LCD_u16MapDataBus(Copy_Data));
 
         // Pulse the E pin to send the character
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_HIGH);
@@ -219,10 +258,7 @@ Std_ReturnType LCD_SendChar(u8 Copy_Data)
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_RS_PIN, GPIO_HIGH);
 
         // Set data pins with higher nibble of the character
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D7_PIN, GET_BIT(Copy_Data, 7));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D6_PIN, GET_BIT(Copy_Data, 6));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D5_PIN, GET_BIT(Copy_Data, 5));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D4_PIN, GET_BIT(Copy_Data, 4));
+        MCAL_GPIO_SetPortValueMasked(LCD_DATA_PORT, LCD_DATA_4BIT_MASK, LCD_u16MapDataBus(Copy_Data >> 4));
 
         // Pulse the E pin to send higher nibble of the character
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_HIGH);
@@ -230,10 +266,7 @@ Std_ReturnType LCD_SendChar(u8 Copy_Data)
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_LOW);
 
         // Set data pins with lower nibble of the character
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D7_PIN, GET_BIT(Copy_Data, 3));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D6_PIN, GET_BIT(Copy_Data, 2));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D5_PIN, GET_BIT(Copy_Data, 1));
-        MCAL_GPIO_SetPinValue(LCD_DATA_PORT, LCD_D4_PIN, GET_BIT(Copy_Data, 0));
+        MCAL_GPIO_SetPortValueMasked(LCD_DATA_PORT, LCD_DATA_4BIT_MASK, LCD_u16MapDataBus(Copy_Data & 0x0F));
 
         // Pulse the E pin to send lower nibble of the character
         MCAL_GPIO_SetPinValue(LCD_CONTROL_PORT, LCD_E_PIN, GPIO_HIGH);
@@ -0,0 +1,30 @@
+/**
+ * @file LA_config.h
+ * @brief This file contains the configuration of the Logic Capture HAL driver.
+ *
+ * Selects the sampling timer (and with it the DMA1 channel of its update request), the sampled GPIO port, the size of
+ * the RAM ring, the channels kept in the RLE stream and the priority of the DMA channel.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+#ifndef LA_CONFIG_H_
+#define LA_CONFIG_H_
+
+/**
+ * The timer that paces the samples: TIM1, TIM2, TIM3 or TIM4.
+ * Its update DMA request is fixed to one DMA1 channel: TIM1 -> CH5, TIM2 -> CH2, TIM3 -> CH3, TIM4 -> CH7.
+ * Do not use the same timer as the pattern generator (PG_TIMER).
+ */
+#define LA_TIMER            TIM3
+/* The sampled port: GPIO_PORTA, GPIO_PORTB or GPIO_PORTC */
+#define LA_PORT             GPIO_PORTB
+/* Ring size in samples (2 bytes each); must be even. Pre + post trigger depth is limited to half of it */
+#define LA_BUFFER_SAMPLES   4096
+/* Pins kept in the RLE stream; the other pins are cleared before encoding so they do not break runs */
+#define LA_CHANNEL_MASK     0xFFFF
+/* DMA channel priority: DMA_PRIORITY_LOW .. DMA_PRIORITY_VERY_HIGH */
+#define LA_DMA_PRIORITY     DMA_PRIORITY_VERY_HIGH
+
+#endif /* LA_CONFIG_H_ */
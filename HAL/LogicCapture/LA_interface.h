@@ -0,0 +1,118 @@
+/**
+ * @file LA_interface.h
+ * @brief Public interface for the Logic Capture HAL driver.
+ *
+ * The logic capture samples a whole GPIO input port into a RAM ring, one DMA transfer per update event of the sampling
+ * timer. Once armed it waits for the trigger with the requested pre-trigger depth, fills the post-trigger depth and
+ * stops; the window is then streamed over USART as run-length-encoded records.
+ *
+ * RLE stream format (all 16-bit fields little endian):
+ *   - header : 0xA5 'L' | sample count (u16) | trigger position in the window (u16) | channel mask (u16) | PSC (u16) | ARR (u16)
+ *   - runs   : port value (u16) | run length (1 or more bytes, 7 bits per byte, least significant group first, bit 7 set
+ *              on every byte but the last)
+ *   The run lengths add up to the sample count. The sample period is (PSC + 1) * (ARR + 1) timer clock cycles.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+#ifndef LA_INTERFACE_H_
+#define LA_INTERFACE_H_
+
+/**
+ * @name Trigger Types
+ * @{
+ */
+#define LA_TRIGGER_NONE         0   /**< Trigger on the first sample after the pre-trigger depth is filled      */
+#define LA_TRIGGER_PATTERN      1   /**< Trigger when (sample & Mask) == (Pattern & Mask)                       */
+#define LA_TRIGGER_EDGE         2   /**< Trigger on a rising edge of RisingMask pins or a falling edge of FallingMask pins */
+/** @} */
+/**
+ * @name Capture States
+ * @{
+ */
+#define LA_STATE_IDLE           0   /**< Not armed                                                              */
+#define LA_STATE_ARMED          1   /**< Sampling, waiting for the trigger                                      */
+#define LA_STATE_TRIGGERED      2   /**< Trigger seen, filling the post-trigger depth                           */
+#define LA_STATE_DONE           3   /**< Capture complete, ready to be streamed                                 */
+#define LA_STATE_OVERRUN        4   /**< The trigger search could not keep up with the sample rate; lower it    */
+/** @} */
+
+/**
+ * @brief Trigger condition.
+ */
+typedef struct
+{
+    u8 Type;            /**< LA_TRIGGER_NONE / LA_TRIGGER_PATTERN / LA_TRIGGER_EDGE     */
+    u16 Mask;           /**< Pattern: pins compared                                     */
+    u16 Pattern;        /**< Pattern: expected level of the compared pins               */
+    u16 RisingMask;     /**< Edge: pins whose low->high transition triggers             */
+    u16 FallingMask;    /**< Edge: pins whose high->low transition triggers             */
+}LA_Trigger_t;
+
+/**
+ * @brief Enables the clocks of DMA1 and the pacing timer and the DMA channel interrupt.
+ *
+ * The sampled pins of LA_PORT must be configured as inputs by the application.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_LA_Init(void);
+/**
+ * @brief Sets the sample period used by the next capture.
+ *
+ * One sample is taken every (Copy_Prescalar + 1) * (Copy_Period + 1) timer clock cycles, e.g. with the 36 MHz timer
+ * clock Copy_Prescalar = 0 and Copy_Period = 11 give 3 MHz.
+ *
+ * @param[in] Copy_Prescalar Timer prescaler (PSC).
+ * @param[in] Copy_Period Timer period (ARR).
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_LA_SetSampleRate(u16 Copy_Prescalar , u16 Copy_Period);
+/**
+ * @brief Sets the trigger condition used by the next capture.
+ *
+ * @param[in] Copy_Trigger The trigger condition.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_LA_SetTrigger(const LA_Trigger_t *Copy_Trigger);
+/**
+ * @brief Starts sampling and waits (in the background) for the trigger.
+ *
+ * The window kept around the trigger is Copy_PreSamples samples before it and Copy_PostSamples samples from it on.
+ * Sampling runs from DMA; the trigger is searched in the DMA half-transfer / transfer-complete interrupts, so the
+ * trigger search costs CPU time while armed, but the sampling instants do not depend on it.
+ *
+ * @param[in] Copy_PreSamples Pre-trigger depth.
+ * @param[in] Copy_PostSamples Post-trigger depth (at least 1, the trigger sample itself).
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise
+ *         (capture running, or Copy_PreSamples + Copy_PostSamples > LA_BUFFER_SAMPLES / 2).
+ */
+Std_ReturnType HAL_LA_Arm(u16 Copy_PreSamples , u16 Copy_PostSamples);
+/**
+ * @brief Stops a running capture. The state goes back to LA_STATE_IDLE.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_LA_Abort(void);
+/**
+ * @brief Gets the capture state.
+ *
+ * @param[out] Copy_State Receives LA_STATE_IDLE, LA_STATE_ARMED, LA_STATE_TRIGGERED, LA_STATE_DONE or LA_STATE_OVERRUN.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_LA_GetState(u8 *Copy_State);
+/**
+ * @brief Streams a completed capture over USART in the RLE format described above.
+ *
+ * @param[in] Copy_UARTx USART_1 or USART_2, already initialized.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise (no completed capture).
+ */
+Std_ReturnType HAL_LA_StreamRLE(u8 Copy_UARTx);
+
+#endif /* LA_INTERFACE_H_ */
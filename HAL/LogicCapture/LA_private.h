@@ -0,0 +1,53 @@
+/**
+ * @file LA_private.h
+ * @brief This file contains the private definitions of the Logic Capture HAL driver.
+ *
+ * Maps LA_TIMER to its update DMA channel, DMA interrupt and RCC enable bit, checks LA_BUFFER_SAMPLES, and defines the
+ * sync bytes and run-length encoding of the RLE stream.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+#ifndef LA_PRIVATE_H_
+#define LA_PRIVATE_H_
+
+/*******************************< Timer -> DMA channel / clock mapping *******************************/
+#if LA_TIMER == TIM1
+    #define LA_DMA_CHANNEL      DMA_REQ_TIM1_UP
+    #define LA_DMA_IRQn         NVIC_DMA1_Channel5_IRQn
+    #define LA_TIMER_RCC_EN     RCC_APB2_TIM1EN
+    #define LA_TIMER_RCC_BUS    RCC_APB2
+#elif LA_TIMER == TIM2
+    #define LA_DMA_CHANNEL      DMA_REQ_TIM2_UP
+    #define LA_DMA_IRQn         NVIC_DMA1_Channel2_IRQn
+    #define LA_TIMER_RCC_EN     RCC_APB1_TIM2EN
+    #define LA_TIMER_RCC_BUS    RCC_APB1
+#elif LA_TIMER == TIM3
+    #define LA_DMA_CHANNEL      DMA_REQ_TIM3_UP
+    #define LA_DMA_IRQn         NVIC_DMA1_Channel3_IRQn
+    #define LA_TIMER_RCC_EN     RCC_APB1_TIM3EN
+    #define LA_TIMER_RCC_BUS    RCC_APB1
+#elif LA_TIMER == TIM4
+    #define LA_DMA_CHANNEL      DMA_REQ_TIM4_UP
+    #define LA_DMA_IRQn         NVIC_DMA1_Channel7_IRQn
+    #define LA_TIMER_RCC_EN     RCC_APB1_TIM4EN
+    #define LA_TIMER_RCC_BUS    RCC_APB1
+#else
+    #error "Wrong LA_TIMER configuration"
+#endif
+
+#if ( (LA_BUFFER_SAMPLES < 2) || (LA_BUFFER_SAMPLES > 65534) || (LA_BUFFER_SAMPLES % 2 != 0) )
+    #error "LA_BUFFER_SAMPLES must be even and in 2..65534"
+#endif
+
+#define LA_HALF_SAMPLES     ( LA_BUFFER_SAMPLES / 2 )
+
+/*******************************< RLE stream *******************************/
+#define LA_RLE_SYNC0        0xA5
+#define LA_RLE_SYNC1        'L'
+/* Run lengths are sent 7 bits per byte, bit 7 set on every byte but the last */
+#define LA_RLE_VARINT_MORE  0x80
+#define LA_RLE_VARINT_MASK  0x7F
+
+#endif /* LA_PRIVATE_H_ */
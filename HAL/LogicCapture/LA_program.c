@@ -0,0 +1,380 @@
+/**
+ * @file LA_program.c
+ * @brief Implementation of the Logic Capture HAL driver.
+ *
+ * The ring is sampled in circular mode; the half-transfer and transfer-complete interrupts search each finished half
+ * for the trigger, so the search costs one pass per half and no interrupt per sample. If a half is overwritten before
+ * it is searched the capture ends in LA_STATE_OVERRUN.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+
+/**************************************** LIB ******************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "STM32F103C8.h"
+
+/**************************************** MCAL *****************************************************/
+#include "RCC_interface.h"
+#include "NVIC_interface.h"
+#include "GPIO_interface.h"
+#include "GPT_interface.h"
+#include "DMA_interface.h"
+#include "USART_interface.h"
+
+/**************************************** HAL *****************************************************/
+#include "LA_interface.h"
+#include "LA_config.h"
+#include "LA_private.h"
+
+/**************************************** Global Variables Section *****************************************************/
+static u16 LA_Buffer[LA_BUFFER_SAMPLES];
+static volatile u8 LA_State = LA_STATE_IDLE;
+static u16 LA_Prescalar = 0;
+static u16 LA_Period = 35;
+static LA_Trigger_t LA_Trigger = { LA_TRIGGER_NONE , 0 , 0 , 0 , 0 };
+static u16 LA_PreSamples = 0;
+static u16 LA_PostSamples = 0;
+static u16 LA_PreRemaining = 0;     /* Samples still needed before a trigger may be accepted    */
+static u16 LA_PostRemaining = 0;    /* Samples still needed after the trigger                   */
+static u16 LA_Prev = 0;             /* Last sample of the previous half (edge trigger)          */
+static u16 LA_TriggerIndex = 0;     /* Ring index of the trigger sample                         */
+
+/**************************************** Static Functions Section *****************************************************/
+static void LA_voidProcessHalf(u16 Copy_Start);
+static void LA_voidFirstHalfDone(void);
+static void LA_voidSecondHalfDone(void);
+static void LA_voidTransferError(void);
+static void LA_voidStopSampling(void);
+static u16 LA_u16GetWriteIndex(void);
+static void LA_voidSendU16(u16 Copy_Value , u8 Copy_UARTx);
+static void LA_voidSendRun(u16 Copy_Value , u16 Copy_Length , u8 Copy_UARTx);
+
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_LA_Init(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    MCAL_Rcc_EnablePrephiral(RCC_AHB_DMA1EN , RCC_AHB);
+    MCAL_Rcc_EnablePrephiral(LA_TIMER_RCC_EN , LA_TIMER_RCC_BUS);
+    MCAL_DMA_StopChannel(LA_DMA_CHANNEL);
+    Local_FunctionStatus = MCAL_DMA_SetCallback(LA_DMA_CHANNEL , DMA_EVENT_HALF_TRANSFER , LA_voidFirstHalfDone);
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_FunctionStatus = MCAL_DMA_SetCallback(LA_DMA_CHANNEL , DMA_EVENT_TRANSFER_COMPLETE , LA_voidSecondHalfDone);
+    }
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_FunctionStatus = MCAL_DMA_SetCallback(LA_DMA_CHANNEL , DMA_EVENT_TRANSFER_ERROR , LA_voidTransferError);
+    }
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_FunctionStatus = MCAL_NVIC_EnableIRQ(LA_DMA_IRQn);
+    }
+    LA_State = LA_STATE_IDLE;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_LA_SetSampleRate(u16 Copy_Prescalar , u16 Copy_Period)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    LA_Prescalar = Copy_Prescalar;
+    LA_Period = Copy_Period;
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_LA_SetTrigger(const LA_Trigger_t *Copy_Trigger)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Trigger != NULL) && (Copy_Trigger->Type <= LA_TRIGGER_EDGE) &&
+         ( (LA_State == LA_STATE_IDLE) || (LA_State == LA_STATE_DONE) || (LA_State == LA_STATE_OVERRUN) ) )
+    {
+        LA_Trigger = *Copy_Trigger;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_LA_Arm(u16 Copy_PreSamples , u16 Copy_PostSamples)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    DMA_ChannelConfig_t Local_Config;
+    u32 Local_IDRAddress = 0;
+    if ( (Copy_PostSamples != 0) && ( (u32)Copy_PreSamples + Copy_PostSamples <= LA_HALF_SAMPLES ) &&
+         (LA_State != LA_STATE_ARMED) && (LA_State != LA_STATE_TRIGGERED) &&
+         (MCAL_GPIO_GetPortRegAddress(LA_PORT , GPIO_REG_IDR , &Local_IDRAddress) == E_OK) )
+    {
+        LA_PreSamples = Copy_PreSamples;
+        LA_PostSamples = Copy_PostSamples;
+        LA_PreRemaining = Copy_PreSamples;
+        /* Level just before the first sample, so an edge on the very first sample is seen */
+        MCAL_GPIO_GetPortValueMasked(LA_PORT , 0xFFFF , &LA_Prev);
+
+        Local_Config.PeripheralAddress = Local_IDRAddress;
+        Local_Config.MemoryAddress = (u32)LA_Buffer;
+        Local_Config.Count = LA_BUFFER_SAMPLES;
+        Local_Config.Direction = DMA_DIR_PERIPH_TO_MEM;
+        Local_Config.PeripheralSize = DMA_SIZE_16BIT;
+        Local_Config.MemorySize = DMA_SIZE_16BIT;
+        Local_Config.PeripheralInc = DMA_INC_DISABLE;
+        Local_Config.MemoryInc = DMA_INC_ENABLE;
+        Local_Config.Mode = DMA_MODE_CIRCULAR;
+        Local_Config.Priority = LA_DMA_PRIORITY;
+        Local_Config.Interrupts = DMA_INT_HALF_TRANSFER | DMA_INT_TRANSFER_COMPLETE | DMA_INT_TRANSFER_ERROR;
+
+        Local_FunctionStatus = GPT_TIMx_SetUpdateDMA(LA_TIMER , LA_Prescalar , LA_Period);
+        if (Local_FunctionStatus == E_OK)
+        {
+            Local_FunctionStatus = MCAL_DMA_InitChannel(LA_DMA_CHANNEL , &Local_Config);
+        }
+        if (Local_FunctionStatus == E_OK)
+        {
+            Local_FunctionStatus = MCAL_DMA_StartChannel(LA_DMA_CHANNEL);
+        }
+        if (Local_FunctionStatus == E_OK)
+        {
+            LA_State = LA_STATE_ARMED;
+            GPT_TIMx_Enable(LA_TIMER);
+        }else
+        {
+            /* The ring was reprogrammed, so a previous capture is gone */
+            LA_voidStopSampling();
+            LA_State = LA_STATE_IDLE;
+        }
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_LA_Abort(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    LA_voidStopSampling();
+    LA_State = LA_STATE_IDLE;
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_LA_GetState(u8 *Copy_State)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if (Copy_State != NULL)
+    {
+        *Copy_State = LA_State;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_LA_StreamRLE(u8 Copy_UARTx)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u16 Local_Count = LA_PreSamples + LA_PostSamples;
+    u16 Local_Index = (u16)( (LA_TriggerIndex + LA_BUFFER_SAMPLES - LA_PreSamples) % LA_BUFFER_SAMPLES );
+    u16 Local_RunValue, Local_Sample;
+    u16 Local_RunLength = 0;
+    if (LA_State == LA_STATE_DONE)
+    {
+        USARTx_SendByte(LA_RLE_SYNC0 , Copy_UARTx);
+        USARTx_SendByte(LA_RLE_SYNC1 , Copy_UARTx);
+        LA_voidSendU16(Local_Count , Copy_UARTx);
+        LA_voidSendU16(LA_PreSamples , Copy_UARTx);
+        LA_voidSendU16(LA_CHANNEL_MASK , Copy_UARTx);
+        LA_voidSendU16(LA_Prescalar , Copy_UARTx);
+        LA_voidSendU16(LA_Period , Copy_UARTx);
+
+        Local_RunValue = LA_Buffer[Local_Index] & LA_CHANNEL_MASK;
+        for (u16 Local_Sent = 0; Local_Sent < Local_Count; Local_Sent++)
+        {
+            Local_Sample = LA_Buffer[Local_Index] & LA_CHANNEL_MASK;
+            if (Local_Sample != Local_RunValue)
+            {
+                LA_voidSendRun(Local_RunValue , Local_RunLength , Copy_UARTx);
+                Local_RunValue = Local_Sample;
+                Local_RunLength = 0;
+            }
+            Local_RunLength++;
+            Local_Index++;
+            if (Local_Index == LA_BUFFER_SAMPLES)
+            {
+                Local_Index = 0;
+            }
+        }
+        LA_voidSendRun(Local_RunValue , Local_RunLength , Copy_UARTx);
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Runs the trigger search / post-trigger count over a half of the ring the DMA has just finished.
+ *
+ * Stopping happens at the first half boundary at or after the end of the post-trigger depth. Since the window is at
+ * most half the ring, the samples written past that boundary before the stop normally land in data older than the
+ * window; the capture is reported as LA_STATE_OVERRUN when the interrupt was too late for that, or when the DMA has
+ * lapped the half being searched.
+ */
+static void LA_voidProcessHalf(u16 Copy_Start)
+{
+    u16 Local_End = Copy_Start + LA_HALF_SAMPLES;
+    u16 Local_Index = Copy_Start;
+    u16 Local_Prev = LA_Prev;
+    u16 Local_Sample;
+    u16 Local_Covered = LA_HALF_SAMPLES;
+    u16 Local_WriteIndex, Local_Boundary, Local_WindowStart;
+    if (LA_State == LA_STATE_ARMED)
+    {
+        if (LA_PreRemaining >= LA_HALF_SAMPLES)
+        {
+            LA_PreRemaining -= LA_HALF_SAMPLES;
+            Local_Index = Local_End;
+        }else if (LA_PreRemaining != 0)
+        {
+            Local_Index += LA_PreRemaining;
+            Local_Prev = LA_Buffer[Local_Index - 1];
+            LA_PreRemaining = 0;
+        }
+        /* One loop per trigger type keeps the per-sample cost down to a load, a compare and a branch or two */
+        switch (LA_Trigger.Type)
+        {
+        case LA_TRIGGER_PATTERN:
+            for ( ; Local_Index < Local_End; Local_Index++)
+            {
+                if ( ( (LA_Buffer[Local_Index] ^ LA_Trigger.Pattern) & LA_Trigger.Mask ) == 0 )
+                {
+                    break;
+                }
+            }
+            break;
+        case LA_TRIGGER_EDGE:
+            for ( ; Local_Index < Local_End; Local_Index++)
+            {
+                Local_Sample = LA_Buffer[Local_Index];
+                if ( ( (u16)(~Local_Prev & Local_Sample) & LA_Trigger.RisingMask ) |
+                     ( (u16)(Local_Prev & ~Local_Sample) & LA_Trigger.FallingMask ) )
+                {
+                    break;
+                }
+                Local_Prev = Local_Sample;
+            }
+            break;
+        default:
+            break;
+        }
+        LA_Prev = LA_Buffer[Local_End - 1];
+        if (Local_Index < Local_End)
+        {
+            LA_TriggerIndex = Local_Index;
+            LA_PostRemaining = LA_PostSamples;
+            Local_Covered = Local_End - Local_Index;
+            LA_State = LA_STATE_TRIGGERED;
+        }
+    }
+    if (LA_State == LA_STATE_TRIGGERED)
+    {
+        if (LA_PostRemaining <= Local_Covered)
+        {
+            LA_voidStopSampling();
+            /* Samples written past the boundary before the stop must not have reached the start of the window */
+            Local_WriteIndex = LA_u16GetWriteIndex();
+            Local_Boundary = Local_End % LA_BUFFER_SAMPLES;
+            Local_WindowStart = (u16)( (LA_TriggerIndex + LA_BUFFER_SAMPLES - LA_PreSamples) % LA_BUFFER_SAMPLES );
+            if ( ( (Local_WriteIndex + LA_BUFFER_SAMPLES - Local_Boundary) % LA_BUFFER_SAMPLES ) >
+                 ( (Local_WindowStart + LA_BUFFER_SAMPLES - Local_Boundary) % LA_BUFFER_SAMPLES ) )
+            {
+                LA_State = LA_STATE_OVERRUN;
+            }else
+            {
+                LA_State = LA_STATE_DONE;
+            }
+        }else
+        {
+            LA_PostRemaining -= Local_Covered;
+        }
+    }
+    if ( (LA_State == LA_STATE_ARMED) || (LA_State == LA_STATE_TRIGGERED) )
+    {
+        /* If the DMA is already back in the half just processed, the CPU cannot keep up with the sample rate */
+        Local_WriteIndex = LA_u16GetWriteIndex();
+        if ( (Local_WriteIndex >= Copy_Start) && (Local_WriteIndex < Local_End) )
+        {
+            LA_voidStopSampling();
+            LA_State = LA_STATE_OVERRUN;
+        }
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void LA_voidFirstHalfDone(void)
+{
+    LA_voidProcessHalf(0);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void LA_voidSecondHalfDone(void)
+{
+    LA_voidProcessHalf(LA_HALF_SAMPLES);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void LA_voidTransferError(void)
+{
+    LA_voidStopSampling();
+    LA_State = LA_STATE_IDLE;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void LA_voidStopSampling(void)
+{
+    GPT_TIMx_ClearUpdateDMA(LA_TIMER);
+    MCAL_DMA_StopChannel(LA_DMA_CHANNEL);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static u16 LA_u16GetWriteIndex(void)
+{
+    u16 Local_Remaining = LA_BUFFER_SAMPLES;
+    MCAL_DMA_GetRemainingCount(LA_DMA_CHANNEL , &Local_Remaining);
+    return (u16)( (LA_BUFFER_SAMPLES - Local_Remaining) % LA_BUFFER_SAMPLES );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void LA_voidSendU16(u16 Copy_Value , u8 Copy_UARTx)
+{
+    USARTx_SendByte((u8)(Copy_Value & 0xFF) , Copy_UARTx);
+    USARTx_SendByte((u8)(Copy_Value >> 8) , Copy_UARTx);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void LA_voidSendRun(u16 Copy_Value , u16 Copy_Length , u8 Copy_UARTx)
+{
+    LA_voidSendU16(Copy_Value , Copy_UARTx);
+    while (Copy_Length > LA_RLE_VARINT_MASK)
+    {
+        USARTx_SendByte((u8)( (Copy_Length & LA_RLE_VARINT_MASK) | LA_RLE_VARINT_MORE ) , Copy_UARTx);
+        Copy_Length >>= 7;
+    }
+    USARTx_SendByte((u8)Copy_Length , Copy_UARTx);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   END_ FILE   ====================================================*/
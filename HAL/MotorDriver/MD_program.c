@@ -65,6 +65,7 @@ Std_ReturnType HAL_MOTOR_STOP(MOTOR_t* Copy_Pins) {
 Std_ReturnType HAL_MOTOR_MOVE(MOTOR_t *Copy_Pins ,u8 Copy_Dir, u16 Copy_Speed_L, u16 Copy_Speed_R) {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
     static u8 Local_PrevDir;
+    u16 Local_DirMask, Local_DirValue;
 
     // Ensure speed values are within range (0-100)
     if (Copy_Speed_L > 100) {
@@ -76,29 +77,21 @@ Std_ReturnType HAL_MOTOR_MOVE(MOTOR_t *Copy_Pins ,u8 Copy_Dir, u16 Copy_Speed_L,
 
     // Set motor direction based on the provided direction
     if (Local_PrevDir != Copy_Dir) {
+        // All four direction pins share MOTOR_PORT, so they are switched together with one store
+        Local_DirMask = (u16)( (1U << Copy_Pins->L_DIR_PIN_F) | (1U << Copy_Pins->R_DIR_PIN_F) |
+                               (1U << Copy_Pins->L_DIR_PIN_B) | (1U << Copy_Pins->R_DIR_PIN_B) );
         switch (Copy_Dir) {
-            case MOTOR_FORWARD:
-                // Set forward direction for both motors
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->L_DIR_PIN_B, GPIO_LOW);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->R_DIR_PIN_B, GPIO_LOW);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->L_DIR_PIN_F, GPIO_HIGH);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->R_DIR_PIN_F, GPIO_HIGH);
-                break;
             case MOTOR_BACKWARD:
                 // Set backward direction for both motors
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->L_DIR_PIN_F, GPIO_LOW);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->R_DIR_PIN_F, GPIO_LOW);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->L_DIR_PIN_B, GPIO_HIGH);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->R_DIR_PIN_B, GPIO_HIGH);
+                Local_DirValue = (u16)( (1U << Copy_Pins->L_DIR_PIN_B) | (1U << Copy_Pins->R_DIR_PIN_B) );
                 break;
+            case MOTOR_FORWARD:
             default:
-                // Default to forward direction for both motors
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->L_DIR_PIN_B, GPIO_LOW);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->R_DIR_PIN_B, GPIO_LOW);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->L_DIR_PIN_F, GPIO_HIGH);
-                MCAL_GPIO_SetPinValue(Copy_Pins->MOTOR_PORT, Copy_Pins->R_DIR_PIN_F, GPIO_HIGH);
+                // Set forward direction for both motors (also the default)
+                Local_DirValue = (u16)( (1U << Copy_Pins->L_DIR_PIN_F) | (1U << Copy_Pins->R_DIR_PIN_F) );
                 break;
         }
+        MCAL_GPIO_SetPortValueMasked(Copy_Pins->MOTOR_PORT, Local_DirMask, Local_DirValue);
         Local_PrevDir = Copy_Dir;
     }
 
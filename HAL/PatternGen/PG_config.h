@@ -0,0 +1,26 @@
+/**
+ * @file PG_config.h
+ * @brief This file contains the configuration of the Pattern Generator HAL driver.
+ *
+ * Selects the pacing timer (and with it the DMA1 channel of its update request), the GPIO port whose BSRR receives the
+ * steps, and the priority of that DMA channel.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+#ifndef PG_CONFIG_H_
+#define PG_CONFIG_H_
+
+/**
+ * The timer that paces the steps: TIM1, TIM2, TIM3 or TIM4.
+ * Its update DMA request is fixed to one DMA1 channel: TIM1 -> CH5, TIM2 -> CH2, TIM3 -> CH3, TIM4 -> CH7.
+ * The channel is owned by the pattern generator (TIM1 shares CH5 with USART1_RX, TIM4 shares CH7 with USART2_TX).
+ */
+#define PG_TIMER            TIM2
+/* The port written by the pattern words: GPIO_PORTA, GPIO_PORTB or GPIO_PORTC */
+#define PG_PORT             GPIO_PORTA
+/* DMA channel priority: DMA_PRIORITY_LOW .. DMA_PRIORITY_VERY_HIGH */
+#define PG_DMA_PRIORITY     DMA_PRIORITY_VERY_HIGH
+
+#endif /* PG_CONFIG_H_ */
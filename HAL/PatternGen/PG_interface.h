@@ -0,0 +1,124 @@
+/**
+ * @file PG_interface.h
+ * @brief Public interface for the Pattern Generator HAL driver.
+ *
+ * The pattern generator writes a buffer of 32-bit words to the BSRR of one GPIO port, one word per update event of the
+ * pacing timer, through DMA. Each word is written as-is: bits 0..15 set the matching pins and bits 16..31 reset them,
+ * so a step only touches the pins it names and the other pins of the port stay usable by the application.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+#ifndef PG_INTERFACE_H_
+#define PG_INTERFACE_H_
+
+/**
+ * @name Streaming Modes
+ * @{
+ */
+#define PG_MODE_ONE_SHOT        0   /**< Play the buffer once then stop the timer                               */
+#define PG_MODE_CIRCULAR        1   /**< Replay the buffer forever                                              */
+/** @} */
+
+/**
+ * @brief Builds one pattern word: pins in Mask are driven to the matching bit of Value, other pins are untouched.
+ */
+#define PG_STEP(MASK , VALUE)   ( ( (u32)( ~(VALUE) & (MASK) & 0xFFFF ) << 16 ) | (u32)( (VALUE) & (MASK) & 0xFFFF ) )
+/**
+ * @brief Pattern word that only sets the given pins / only resets the given pins.
+ */
+#define PG_SET(PINS)            ( (u32)( (PINS) & 0xFFFF ) )
+#define PG_RESET(PINS)          ( (u32)( (PINS) & 0xFFFF ) << 16 )
+
+/**
+ * @brief Callback called at the end of a one-shot pattern, or each time a circular pattern wraps.
+ */
+typedef void (*PG_DoneFunc_t)(void);
+/**
+ * @brief Refill callback of the double-buffered mode.
+ *
+ * Called from the DMA interrupt with the half of the buffer that has just been played and is now free. It must be
+ * refilled before the DMA reaches it again, i.e. within Copy_Steps step periods.
+ *
+ * @param[in] Copy_FreeHalf First word of the free half.
+ * @param[in] Copy_Steps Number of words in the free half.
+ */
+typedef void (*PG_RefillFunc_t)(u32 *Copy_FreeHalf , u16 Copy_Steps);
+
+/**
+ * @brief Enables the clocks of DMA1 and the pacing timer and the DMA channel interrupt.
+ *
+ * The pins of PG_PORT driven by the patterns must be configured as outputs by the application.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_PG_Init(void);
+/**
+ * @brief Sets the step period used by the next start.
+ *
+ * One pattern word is written every (Copy_Prescalar + 1) * (Copy_Period + 1) timer clock cycles. With the 36 MHz timer
+ * clock and Copy_Prescalar = 0, Copy_Period = 35 gives a 1 MHz step rate.
+ *
+ * @param[in] Copy_Prescalar Timer prescaler (PSC).
+ * @param[in] Copy_Period Timer period (ARR).
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_PG_SetStepRate(u16 Copy_Prescalar , u16 Copy_Period);
+/**
+ * @brief Starts streaming a pattern buffer.
+ *
+ * @param[in] Copy_Buffer Pattern words, in RAM or flash. It must stay valid while the pattern runs.
+ * @param[in] Copy_Steps Number of words in the buffer (1..65535).
+ * @param[in] Copy_Mode PG_MODE_ONE_SHOT or PG_MODE_CIRCULAR.
+ * @param[in] Copy_DoneFunc Called at the end of a one-shot pattern / at each wrap of a circular one. NULL keeps the
+ *                          DMA interrupt disabled, so a circular pattern then costs no CPU time at all.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise (also if a pattern is running).
+ */
+Std_ReturnType HAL_PG_Start(const u32 *Copy_Buffer , u16 Copy_Steps , u8 Copy_Mode , PG_DoneFunc_t Copy_DoneFunc);
+/**
+ * @brief Starts streaming a double-buffered pattern.
+ *
+ * The buffer is played circularly and split into two halves. When the DMA finishes one half (half-transfer or
+ * transfer-complete event) Copy_RefillFunc is called with that half while the other half keeps playing.
+ *
+ * @param[in] Copy_Buffer Pattern words in RAM, both halves pre-filled.
+ * @param[in] Copy_Steps Total number of words in the buffer; must be even.
+ * @param[in] Copy_RefillFunc The refill callback; must not be NULL.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise (also if a pattern is running).
+ */
+Std_ReturnType HAL_PG_StartDoubleBuffer(u32 *Copy_Buffer , u16 Copy_Steps , PG_RefillFunc_t Copy_RefillFunc);
+/**
+ * @brief Stops the pattern. The pins keep the level of the last written step.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_PG_Stop(void);
+/**
+ * @brief Reports whether a pattern is running.
+ *
+ * @param[out] Copy_IsBusy Receives 1 while a pattern is running, 0 otherwise.
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_PG_IsBusy(u8 *Copy_IsBusy);
+/**
+ * @brief Builds a software PWM period for up to 16 pins.
+ *
+ * Step 0 sets every pin of Copy_Mask with a non-zero duty and step Copy_Duty[n] resets pin n, so each pin is high for
+ * Copy_Duty[n] steps out of Copy_Steps. A duty of 0 keeps the pin low and a duty >= Copy_Steps keeps it high. Play the
+ * result with PG_MODE_CIRCULAR to get a continuous PWM of frequency StepRate / Copy_Steps.
+ *
+ * @param[out] Copy_Buffer Receives Copy_Steps pattern words.
+ * @param[in] Copy_Steps PWM resolution in steps.
+ * @param[in] Copy_Mask Pins driven by the PWM (bit n = pin n).
+ * @param[in] Copy_Duty Duty of each pin in steps, indexed by pin number (16 entries).
+ *
+ * @retval Std_ReturnType Returns E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType HAL_PG_FillPWM(u32 *Copy_Buffer , u16 Copy_Steps , u16 Copy_Mask , const u16 *Copy_Duty);
+
+#endif /* PG_INTERFACE_H_ */
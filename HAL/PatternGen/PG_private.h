@@ -0,0 +1,43 @@
+/**
+ * @file PG_private.h
+ * @brief This file contains the private definitions of the Pattern Generator HAL driver.
+ *
+ * Maps PG_TIMER to its update DMA channel, DMA interrupt and RCC enable bit, and defines the driver states.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+#ifndef PG_PRIVATE_H_
+#define PG_PRIVATE_H_
+
+/*******************************< Timer -> DMA channel / clock mapping *******************************/
+#if PG_TIMER == TIM1
+    #define PG_DMA_CHANNEL      DMA_REQ_TIM1_UP
+    #define PG_DMA_IRQn         NVIC_DMA1_Channel5_IRQn
+    #define PG_TIMER_RCC_EN     RCC_APB2_TIM1EN
+    #define PG_TIMER_RCC_BUS    RCC_APB2
+#elif PG_TIMER == TIM2
+    #define PG_DMA_CHANNEL      DMA_REQ_TIM2_UP
+    #define PG_DMA_IRQn         NVIC_DMA1_Channel2_IRQn
+    #define PG_TIMER_RCC_EN     RCC_APB1_TIM2EN
+    #define PG_TIMER_RCC_BUS    RCC_APB1
+#elif PG_TIMER == TIM3
+    #define PG_DMA_CHANNEL      DMA_REQ_TIM3_UP
+    #define PG_DMA_IRQn         NVIC_DMA1_Channel3_IRQn
+    #define PG_TIMER_RCC_EN     RCC_APB1_TIM3EN
+    #define PG_TIMER_RCC_BUS    RCC_APB1
+#elif PG_TIMER == TIM4
+    #define PG_DMA_CHANNEL      DMA_REQ_TIM4_UP
+    #define PG_DMA_IRQn         NVIC_DMA1_Channel7_IRQn
+    #define PG_TIMER_RCC_EN     RCC_APB1_TIM4EN
+    #define PG_TIMER_RCC_BUS    RCC_APB1
+#else
+    #error "Wrong PG_TIMER configuration"
+#endif
+
+/*******************************< Engine state *******************************/
+#define PG_STATE_IDLE       0
+#define PG_STATE_RUNNING    1
+
+#endif /* PG_PRIVATE_H_ */
@@ -0,0 +1,277 @@
+/**
+ * @file PG_program.c
+ * @brief Implementation of the Pattern Generator HAL driver.
+ *
+ * A transfer is armed in the order timer (update DMA request set after its UG), DMA channel, counter enable, so the
+ * first step lands one period after the start. One-shot runs stop the timer request from the transfer-complete
+ * callback; a transfer error stops the generator.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @version V01
+ */
+
+/**************************************** LIB ******************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "STM32F103C8.h"
+
+/**************************************** MCAL *****************************************************/
+#include "RCC_interface.h"
+#include "NVIC_interface.h"
+#include "GPIO_interface.h"
+#include "GPT_interface.h"
+#include "DMA_interface.h"
+
+/**************************************** HAL *****************************************************/
+#include "PG_interface.h"
+#include "PG_config.h"
+#include "PG_private.h"
+
+/**************************************** Global Variables Section *****************************************************/
+static volatile u8 PG_State = PG_STATE_IDLE;
+static u16 PG_Prescalar = 0;
+static u16 PG_Period = 35;
+static PG_DoneFunc_t PG_DoneFunc = NULL;
+static PG_RefillFunc_t PG_RefillFunc = NULL;
+static u32 *PG_DoubleBuffer = NULL;
+static u16 PG_HalfSteps = 0;
+
+/**************************************** Static Functions Section *****************************************************/
+static Std_ReturnType PG_StartTransfer(u32 Copy_BufferAddress , u16 Copy_Steps , u8 Copy_Mode , u8 Copy_Interrupts);
+static void PG_voidOneShotComplete(void);
+static void PG_voidCircularWrap(void);
+static void PG_voidFirstHalfFree(void);
+static void PG_voidSecondHalfFree(void);
+static void PG_voidTransferError(void);
+
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_PG_Init(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    MCAL_Rcc_EnablePrephiral(RCC_AHB_DMA1EN , RCC_AHB);
+    MCAL_Rcc_EnablePrephiral(PG_TIMER_RCC_EN , PG_TIMER_RCC_BUS);
+    MCAL_DMA_StopChannel(PG_DMA_CHANNEL);
+    MCAL_NVIC_EnableIRQ(PG_DMA_IRQn);
+    PG_State = PG_STATE_IDLE;
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_PG_SetStepRate(u16 Copy_Prescalar , u16 Copy_Period)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    PG_Prescalar = Copy_Prescalar;
+    PG_Period = Copy_Period;
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_PG_Start(const u32 *Copy_Buffer , u16 Copy_Steps , u8 Copy_Mode , PG_DoneFunc_t Copy_DoneFunc)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Buffer != NULL) && (Copy_Steps != 0) && (PG_State == PG_STATE_IDLE) )
+    {
+        PG_DoneFunc = Copy_DoneFunc;
+        switch (Copy_Mode)
+        {
+        case PG_MODE_ONE_SHOT:
+            /* The transfer-complete interrupt is always needed to stop the timer at the end */
+            MCAL_DMA_SetCallback(PG_DMA_CHANNEL , DMA_EVENT_TRANSFER_COMPLETE , PG_voidOneShotComplete);
+            MCAL_DMA_SetCallback(PG_DMA_CHANNEL , DMA_EVENT_HALF_TRANSFER , NULL);
+            Local_FunctionStatus = PG_StartTransfer((u32)Copy_Buffer , Copy_Steps , DMA_MODE_NORMAL , DMA_INT_TRANSFER_COMPLETE);
+            break;
+        case PG_MODE_CIRCULAR:
+            MCAL_DMA_SetCallback(PG_DMA_CHANNEL , DMA_EVENT_TRANSFER_COMPLETE , PG_voidCircularWrap);
+            MCAL_DMA_SetCallback(PG_DMA_CHANNEL , DMA_EVENT_HALF_TRANSFER , NULL);
+            Local_FunctionStatus = PG_StartTransfer((u32)Copy_Buffer , Copy_Steps , DMA_MODE_CIRCULAR ,
+                                                    (Copy_DoneFunc != NULL) ? DMA_INT_TRANSFER_COMPLETE : DMA_INT_NONE);
+            break;
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_PG_StartDoubleBuffer(u32 *Copy_Buffer , u16 Copy_Steps , PG_RefillFunc_t Copy_RefillFunc)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Buffer != NULL) && (Copy_RefillFunc != NULL) && (Copy_Steps >= 2) && ((Copy_Steps & 1) == 0) &&
+         (PG_State == PG_STATE_IDLE) )
+    {
+        /* DMA1 has no second memory address register: the two buffers are the halves of one circular buffer,
+           handed back to the application on the half-transfer and transfer-complete events */
+        PG_DoubleBuffer = Copy_Buffer;
+        PG_HalfSteps = Copy_Steps / 2;
+        PG_RefillFunc = Copy_RefillFunc;
+        MCAL_DMA_SetCallback(PG_DMA_CHANNEL , DMA_EVENT_HALF_TRANSFER , PG_voidFirstHalfFree);
+        MCAL_DMA_SetCallback(PG_DMA_CHANNEL , DMA_EVENT_TRANSFER_COMPLETE , PG_voidSecondHalfFree);
+        Local_FunctionStatus = PG_StartTransfer((u32)Copy_Buffer , Copy_Steps , DMA_MODE_CIRCULAR ,
+                                                DMA_INT_HALF_TRANSFER | DMA_INT_TRANSFER_COMPLETE);
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_PG_Stop(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    GPT_TIMx_ClearUpdateDMA(PG_TIMER);
+    MCAL_DMA_StopChannel(PG_DMA_CHANNEL);
+    PG_State = PG_STATE_IDLE;
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_PG_IsBusy(u8 *Copy_IsBusy)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if (Copy_IsBusy != NULL)
+    {
+        *Copy_IsBusy = (PG_State == PG_STATE_RUNNING);
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType HAL_PG_FillPWM(u32 *Copy_Buffer , u16 Copy_Steps , u16 Copy_Mask , const u16 *Copy_Duty)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Buffer != NULL) && (Copy_Duty != NULL) && (Copy_Steps != 0) )
+    {
+        for (u16 Local_Step = 0; Local_Step < Copy_Steps; Local_Step++)
+        {
+            Copy_Buffer[Local_Step] = 0;
+        }
+        for (u8 Local_Pin = 0; Local_Pin < 16; Local_Pin++)
+        {
+            if (GET_BIT(Copy_Mask , Local_Pin))
+            {
+                if (Copy_Duty[Local_Pin] == 0)
+                {
+                    Copy_Buffer[0] |= PG_RESET(1U << Local_Pin);
+                }else
+                {
+                    Copy_Buffer[0] |= PG_SET(1U << Local_Pin);
+                    if (Copy_Duty[Local_Pin] < Copy_Steps)
+                    {
+                        Copy_Buffer[Copy_Duty[Local_Pin]] |= PG_RESET(1U << Local_Pin);
+                    }
+                }
+            }
+        }
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Arms the DMA channel on the port BSRR and starts the pacing timer.
+ */
+static Std_ReturnType PG_StartTransfer(u32 Copy_BufferAddress , u16 Copy_Steps , u8 Copy_Mode , u8 Copy_Interrupts)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    DMA_ChannelConfig_t Local_Config;
+    u32 Local_BSRRAddress = 0;
+    if (MCAL_GPIO_GetPortRegAddress(PG_PORT , GPIO_REG_BSRR , &Local_BSRRAddress) == E_OK)
+    {
+        Local_Config.PeripheralAddress = Local_BSRRAddress;
+        Local_Config.MemoryAddress = Copy_BufferAddress;
+        Local_Config.Count = Copy_Steps;
+        Local_Config.Direction = DMA_DIR_MEM_TO_PERIPH;
+        Local_Config.PeripheralSize = DMA_SIZE_32BIT;
+        Local_Config.MemorySize = DMA_SIZE_32BIT;
+        Local_Config.PeripheralInc = DMA_INC_DISABLE;
+        Local_Config.MemoryInc = DMA_INC_ENABLE;
+        Local_Config.Mode = Copy_Mode;
+        Local_Config.Priority = PG_DMA_PRIORITY;
+        Local_Config.Interrupts = Copy_Interrupts | DMA_INT_TRANSFER_ERROR;
+        Local_FunctionStatus = MCAL_DMA_SetCallback(PG_DMA_CHANNEL , DMA_EVENT_TRANSFER_ERROR , PG_voidTransferError);
+        /* Timer first (UDE is set after its UG), then the channel, then the counter: the first step lands one period after start */
+        if (Local_FunctionStatus == E_OK)
+        {
+            Local_FunctionStatus = GPT_TIMx_SetUpdateDMA(PG_TIMER , PG_Prescalar , PG_Period);
+        }
+        if (Local_FunctionStatus == E_OK)
+        {
+            Local_FunctionStatus = MCAL_DMA_InitChannel(PG_DMA_CHANNEL , &Local_Config);
+        }
+        if (Local_FunctionStatus == E_OK)
+        {
+            Local_FunctionStatus = MCAL_DMA_StartChannel(PG_DMA_CHANNEL);
+        }
+        if (Local_FunctionStatus == E_OK)
+        {
+            PG_State = PG_STATE_RUNNING;
+            GPT_TIMx_Enable(PG_TIMER);
+        }else
+        {
+            /* Leave the timer without update requests and the channel off */
+            HAL_PG_Stop();
+        }
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void PG_voidOneShotComplete(void)
+{
+    HAL_PG_Stop();
+    if (PG_DoneFunc != NULL)
+    {
+        PG_DoneFunc();
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void PG_voidCircularWrap(void)
+{
+    if (PG_DoneFunc != NULL)
+    {
+        PG_DoneFunc();
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void PG_voidFirstHalfFree(void)
+{
+    PG_RefillFunc(PG_DoubleBuffer , PG_HalfSteps);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void PG_voidSecondHalfFree(void)
+{
+    PG_RefillFunc(PG_DoubleBuffer + PG_HalfSteps , PG_HalfSteps);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void PG_voidTransferError(void)
+{
+    /* The channel is already disabled by hardware; stop the timer and free the engine */
+    HAL_PG_Stop();
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   END_ FILE   ====================================================*/
@@ -19,6 +19,7 @@
 #include "STM32F103C8.h"
 /**************************************** MCAL *****************************************************/
 #include "RCC_interface.h"
+#include "SCB_interface.h"
 #include "SYSTICK_interface.h"
 #include "GPIO_interface.h"
 #include "AFIO_interface.h"
@@ -32,6 +33,9 @@
 static volatile US_t Ultrasonic[NUMBER_OF_ULTRASONIC_USED];
 u32 distance;
 static volatile u8 echoRisingFlag,readingState;
+/**< Low word of the uptime (us) of the trigger pulse, then of the echo rising edge. A u32 is written in one store, so
+     the ISR and the timeout loop never see half an update, and u32 differences stay right across its 71-minute wrap */
+static volatile u32 echoStartTime;
 /*====================================================   Start_FUNCTION   ====================================================*/
 Std_ReturnType Ultrasonic_init(US_ID_t ID, US_config_t * Ultrasonic_config)
 {
@@ -94,6 +98,7 @@ Std_ReturnType Ultrasonic_init(US_ID_t ID, US_config_t * Ultrasonic_config)
     MCAL_EXTI_EnableLine(Ultrasonic[ID].Echo_pin);
     MCAL_EXTI_SetTrigger(Ultrasonic[ID].Echo_pin,EXTI_BOTH_EDGE);
     MCAL_SYSTICK_vINIT();
+    MCAL_SCB_InitDelay();
     Local_FunctionStatus=E_OK;
 
     return Local_FunctionStatus;
@@ -111,19 +116,21 @@ Std_ReturnType Ultrasonic_readDistance(US_ID_t ID,f32* copy_US_reading)
         MCAL_EXTI_EnableLine(Ultrasonic[ID].Echo_pin);
         MCAL_EXTI_SetTrigger(Ultrasonic[ID].Echo_pin,EXTI_BOTH_EDGE);
         MCAL_GPIO_SetPinValue(Ultrasonic[ID].Trig_port,Ultrasonic[ID].Trig_pin,GPIO_LOW);
-        MCAL_SYSTICK_DelayUS(2);
+        MCAL_SCB_DelayUs(2);
         MCAL_GPIO_SetPinValue(Ultrasonic[ID].Trig_port,Ultrasonic[ID].Trig_pin,GPIO_HIGH);
-        MCAL_SYSTICK_DelayUS(10);
+        MCAL_SCB_DelayUs(10);
         MCAL_GPIO_SetPinValue(Ultrasonic[ID].Trig_port,Ultrasonic[ID].Trig_pin,GPIO_LOW);
+        u64 local_Start;
+        MCAL_SYSTICK_GetTimeUs64(&local_Start);
+        echoStartTime=(u32)local_Start;
         while(readingState == READING_PENDING)
         {
-            u32 local_Counts;
-            MCAL_SYSTICK_GetElapsedCounts(&local_Counts);
-            if(local_Counts>Ultrasonic[ID].Timeout)
+            u64 local_Now;
+            MCAL_SYSTICK_GetTimeUs64(&local_Now);
+            if(((u32)local_Now - echoStartTime)>Ultrasonic[ID].Timeout)
             {
                 MCAL_EXTI_DisableLine(Ultrasonic[ID].Echo_pin);
                 readingState=READING_DONE;
-                MCAL_SYSTICK_Stop();
                 *copy_US_reading=OUT_OF_RANGE;
                 break;
             }
@@ -158,19 +165,20 @@ Std_ReturnType Ultrasonic_setState(US_ID_t ID, Ultrasonic_state_t state)
 }
 void CalcDistance()
 {
+    u64 local_Now;
+    MCAL_SYSTICK_GetTimeUs64(&local_Now);
     if(echoRisingFlag == RISING_DETECTED)
     {
-        MCAL_SYSTICK_SetIntervalSingle(TIMER_PERIOD, callback_fun);
+        echoStartTime=(u32)local_Now;
         echoRisingFlag=FALLING_DETECTED;
 
     }else
     {
         if (readingState != READING_DONE)
         {
+            /**< 0.017 cm/us (half the speed of sound) in integer math: no soft-float double in the ISR */
+            distance=(((u32)local_Now - echoStartTime) * 17) / 1000;
             readingState=READING_DONE;
-            MCAL_SYSTICK_GetElapsedCounts(&distance);
-            distance*=0.017;
-            MCAL_SYSTICK_Reset();
         }
 
     }
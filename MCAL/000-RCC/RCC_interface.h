@@ -177,6 +177,19 @@
 #define USB_Pre_1_5         0
 #define USB_Pre_0           1
 /** @} */
+/**
+ * @defgroup RCC_Reset_Flags RCC Reset Flags
+ * @brief Bits returned by MCAL_RCC_GetResetFlags. Several can be set at once: every internal reset also drives NRST,
+ *        so RCC_RESET_FLAG_PIN comes with most of the others.
+ * @{
+ */
+#define RCC_RESET_FLAG_PIN          0x01    /* NRST pin                         */
+#define RCC_RESET_FLAG_POWER_ON     0x02    /* Power-on / power-down reset      */
+#define RCC_RESET_FLAG_SOFTWARE     0x04    /* SYSRESETREQ                      */
+#define RCC_RESET_FLAG_IWDG         0x08    /* Independent watchdog             */
+#define RCC_RESET_FLAG_WWDG         0x10    /* Window watchdog                  */
+#define RCC_RESET_FLAG_LOW_POWER    0x20    /* Illegal Stop/Standby entry       */
+/** @} */
 /** @} */  /* End of RCC_Peripheral_Macros group */
 
 /**
@@ -310,5 +323,23 @@ Std_ReturnType MCAL_Rcc_EnablePrephiral(u8 Copy_PeripheralId , u8 Copy_BusId);
  * @retval E_NOT_OK Peripheral disabling failed.
  */
 Std_ReturnType MCAL_Rcc_DisablePrephiral(u8 Copy_PeripheralId , u8 Copy_BusId);
+/**
+ * @brief Reads the reset flags latched in RCC_CSR.
+ *
+ * The flags accumulate over resets until MCAL_RCC_ClearResetFlags is called.
+ *
+ * @param[out] Copy_Flags Receives a combination of the RCC_RESET_FLAG_x bits.
+ * @return Std_ReturnType
+ * @retval E_OK     Flags read successfully.
+ * @retval E_NOT_OK NULL pointer.
+ */
+Std_ReturnType MCAL_RCC_GetResetFlags(u8 *Copy_Flags);
+/**
+ * @brief Clears the reset flags (RMVF), so the next reset reports only its own cause.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK     Flags cleared successfully.
+ */
+Std_ReturnType MCAL_RCC_ClearResetFlags(void);
 /*** @}*/
 #endif /* MCAL_RCC_INTERFACE_H_ */
\ No newline at end of file
@@ -101,6 +101,15 @@
 #define RCC_CR_PLLRDY           25  //  PLL Ready
 /** @} */ // end of RCC_CR_Bit_Definitions
 
+/**
+ * @defgroup RCC_CSR_Bit_Definitions RCC Control/Status Register (RCC_CSR) Bit Definitions
+ * @{
+ */
+#define RCC_CSR_RMVF            24  //  Remove reset flags
+#define RCC_CSR_PINRSTF         26  //  First of the six reset flags (PIN, POR, SFT, IWDG, WWDG, LPWR)
+#define RCC_CSR_RSTF_MASK       0x3F
+/** @} */ // end of RCC_CSR_Bit_Definitions
+
 /**
  * @defgroup RCC_Clock_Source RCC Clock Source Macros
  * @{
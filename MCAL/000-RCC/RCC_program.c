@@ -243,3 +243,29 @@ Std_ReturnType MCAL_RCC_EnaleMCO(void)
     return local_functionStates;
 }
 /*====================================================   END_ FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_RCC_GetResetFlags(u8 *Copy_Flags)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (Copy_Flags != NULL)
+    {
+        *Copy_Flags = (u8)( (RCC_CSR >> RCC_CSR_PINRSTF) & RCC_CSR_RSTF_MASK );
+        local_functionStates = E_OK;
+    }else
+    {
+        local_functionStates = E_NOT_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_ FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_RCC_ClearResetFlags(void)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    SET_BIT( RCC_CSR , RCC_CSR_RMVF );
+    local_functionStates = E_OK;
+    return local_functionStates;
+}
+/*====================================================   END_ FUNCTION   ====================================================*/
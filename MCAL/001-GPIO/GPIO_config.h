@@ -14,5 +14,15 @@
  */
 #ifndef MCAL_GPIO_CONFIG_H_
 #define MCAL_GPIO_CONFIG_H_
+/**
+ * @brief Pins filtered by the debounce service (MCAL_GPIO_DebounceTick).
+ *
+ * One 16-bit mask per port, bit n set means pin n of that port is debounced. A port with a mask of 0x0000 is not sampled.
+ * A pin must stay at its new level for GPIO_DEBOUNCE_SAMPLES consecutive ticks before the stable state changes, so the
+ * debounce time is GPIO_DEBOUNCE_SAMPLES * (tick period). With a 5 ms tick a pin is accepted after 20 ms.
+ */
+#define GPIO_DEBOUNCE_PORTA_MASK        0x0000
+#define GPIO_DEBOUNCE_PORTB_MASK        0x0000
+#define GPIO_DEBOUNCE_PORTC_MASK        0x0000
 
 #endif /* MCAL_GPIO_INTERFACE_H_ */
\ No newline at end of file
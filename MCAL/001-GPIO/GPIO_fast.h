@@ -0,0 +1,137 @@
+/**
+ **********************************************************************************************************************************
+ * @brief Header-only fast path for the GPIO driver.
+ *
+ * @version V01
+ ***********************************************************************************************************************************
+ * This header provides static inline variants of the most used GPIO services for bit-banged protocols and tight loops.
+ * The port is selected from a const table of register pointers instead of a switch, no status is returned, and every
+ * register access is a single load or store. When the port and pin are compile-time constants each call folds down to
+ * one store to BSRR/BRR (or one load from IDR).
+ *
+ * Argument checks are only compiled in debug builds (when DEBUG is defined, as the Debug build configuration does).
+ * A failed check traps in GPIO_FAST_ASSERT so the bad caller can be found with the debugger.
+ *
+ * @note This header is opt-in. Include it next to GPIO_interface.h in the files that need it; the out-of-line
+ * functions in GPIO_program.c are unchanged.
+ **********************************************************************************************************************************
+ */
+
+#ifndef MCAL_GPIO_FAST_H_
+#define MCAL_GPIO_FAST_H_
+
+#include "STD_TYPES.h"
+#include "GPIO_interface.h"
+#include "GPIO_private.h"
+
+/******************************************< ARGUMENT CHECKS (DEBUG ONLY) ******************************************/
+#ifdef DEBUG
+#define GPIO_FAST_ASSERT(COND)      do{ if( !(COND) ){ while(1); } }while(0)
+#else
+#define GPIO_FAST_ASSERT(COND)      ((void)0)
+#endif
+
+/******************************************< PORT TABLE ******************************************/
+/* Indexed with GPIO_PORTA/B/C; kept static const so constant indices are folded to the port base address */
+static volatile GPIOx_t * const GPIO_FastPortTable[GPIO_PORTS_COUNT] =
+{
+    MCAL_GPIOA,
+    MCAL_GPIOB,
+    MCAL_GPIOC
+};
+
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Configures the mode of a pin (inline variant of MCAL_GPIO_SetPinMode).
+ *
+ * @param[in] Copy_PortID GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ * @param[in] Copy_PinID GPIO_PIN0 .. GPIO_PIN15.
+ * @param[in] Copy_PinMode One of the GPIO_INPUT_xxx / GPIO_OUTPUT_xxx mode options.
+ */
+static inline void MCAL_GPIO_FastSetPinMode(u8 Copy_PortID , u8 Copy_PinID , u8 Copy_PinMode)
+{
+    GPIO_FAST_ASSERT( (Copy_PortID < GPIO_PORTS_COUNT) && (Copy_PinID < 16) && (Copy_PinMode <= 0b1111) );
+    /* CRH follows CRL in the register map, so pins 8..15 select the next word */
+    volatile u32 *Local_ConfigReg = &(GPIO_FastPortTable[Copy_PortID]->CRL) + (Copy_PinID >> 3);
+    u8 Local_Shift = (u8)((Copy_PinID & 0x07) * 4);
+    *Local_ConfigReg = ( *Local_ConfigReg & ~( (u32)0b1111 << Local_Shift ) ) | ( (u32)Copy_PinMode << Local_Shift );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Drives a pin high with a single BSRR store.
+ */
+static inline void MCAL_GPIO_FastSetPin(u8 Copy_PortID , u8 Copy_PinID)
+{
+    GPIO_FAST_ASSERT( (Copy_PortID < GPIO_PORTS_COUNT) && (Copy_PinID < 16) );
+    GPIO_FastPortTable[Copy_PortID]->BSRR = ( (u32)1 << Copy_PinID );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Drives a pin low with a single BRR store.
+ */
+static inline void MCAL_GPIO_FastResetPin(u8 Copy_PortID , u8 Copy_PinID)
+{
+    GPIO_FAST_ASSERT( (Copy_PortID < GPIO_PORTS_COUNT) && (Copy_PinID < 16) );
+    GPIO_FastPortTable[Copy_PortID]->BRR = ( (u32)1 << Copy_PinID );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Writes GPIO_HIGH or GPIO_LOW to a pin with a single BSRR store (inline variant of MCAL_GPIO_SetPinValue).
+ */
+static inline void MCAL_GPIO_FastWritePin(u8 Copy_PortID , u8 Copy_PinID , u8 Copy_PinValue)
+{
+    GPIO_FAST_ASSERT( (Copy_PortID < GPIO_PORTS_COUNT) && (Copy_PinID < 16) && (Copy_PinValue <= GPIO_HIGH) );
+    GPIO_FastPortTable[Copy_PortID]->BSRR = ( (u32)1 << ( Copy_PinValue ? Copy_PinID : (Copy_PinID + GPIO_BSRR_RESET_SHIFT) ) );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Toggles a pin. ODR is read once and the new level is committed with one BSRR store, so other pins are never disturbed.
+ */
+static inline void MCAL_GPIO_FastTogglePin(u8 Copy_PortID , u8 Copy_PinID)
+{
+    GPIO_FAST_ASSERT( (Copy_PortID < GPIO_PORTS_COUNT) && (Copy_PinID < 16) );
+    u32 Local_PinMask = ( (u32)1 << Copy_PinID );
+    u32 Local_ODR = GPIO_FastPortTable[Copy_PortID]->ODR;
+    GPIO_FastPortTable[Copy_PortID]->BSRR = ( (Local_ODR & Local_PinMask) << GPIO_BSRR_RESET_SHIFT ) | ( ~Local_ODR & Local_PinMask );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Reads the level of a pin from IDR (inline variant of MCAL_GPIO_GetPinValue).
+ *
+ * @retval u8 GPIO_HIGH or GPIO_LOW.
+ */
+static inline u8 MCAL_GPIO_FastReadPin(u8 Copy_PortID , u8 Copy_PinID)
+{
+    GPIO_FAST_ASSERT( (Copy_PortID < GPIO_PORTS_COUNT) && (Copy_PinID < 16) );
+    return (u8)( ( GPIO_FastPortTable[Copy_PortID]->IDR >> Copy_PinID ) & 1U );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Writes the pins selected by the mask with one BSRR store (inline variant of MCAL_GPIO_SetPortValueMasked).
+ */
+static inline void MCAL_GPIO_FastWritePortMasked(u8 Copy_PortID , u16 Copy_Mask , u16 Copy_Value)
+{
+    GPIO_FAST_ASSERT( Copy_PortID < GPIO_PORTS_COUNT );
+    GPIO_FastPortTable[Copy_PortID]->BSRR = ( (u32)(~Copy_Value & Copy_Mask) << GPIO_BSRR_RESET_SHIFT ) | (u32)(Copy_Value & Copy_Mask);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Reads the whole input port with one IDR load.
+ *
+ * @retval u16 The 16 pin levels of the port.
+ */
+static inline u16 MCAL_GPIO_FastReadPort(u8 Copy_PortID)
+{
+    GPIO_FAST_ASSERT( Copy_PortID < GPIO_PORTS_COUNT );
+    return (u16)( GPIO_FastPortTable[Copy_PortID]->IDR );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+
+#endif /* MCAL_GPIO_FAST_H_ */
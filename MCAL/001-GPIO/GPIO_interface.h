@@ -68,6 +68,25 @@
             
 #define GPIO_UNLOCKED                             0
 #define GPIO_LOCKED                               1
+/***********************************< PORT DATA REGISTERS (for DMA / bus masters) ***********************************/
+#define GPIO_REG_IDR                              0
+#define GPIO_REG_ODR                              1
+#define GPIO_REG_BSRR                             2
+#define GPIO_REG_BRR                              3
+/***********************************< PIN CONFIGURATION TABLE ENTRY ***********************************/
+/**
+ * @brief One entry of a pin configuration table passed to MCAL_GPIO_ApplyConfigTable.
+ *
+ * PinValue is the initial ODR level of the pin: the output level for output modes, or GPIO_HIGH for pull-up and GPIO_LOW
+ * for pull-down when PinMode is GPIO_INPUT_PULL_UP_MODE / GPIO_INPUT_PULL_DOWN_MODE.
+ */
+typedef struct
+{
+    u8 PortID;      /* GPIO_PORTA, GPIO_PORTB or GPIO_PORTC  */
+    u8 PinID;       /* GPIO_PIN0 .. GPIO_PIN15               */
+    u8 PinMode;     /* GPIO_INPUT_xxx / GPIO_OUTPUT_xxx      */
+    u8 PinValue;    /* GPIO_LOW or GPIO_HIGH                 */
+}GPIO_PinCfg_t;
 /***********************************< FUNCTIONS PROTOTYPES AND DESCRIPTION ***********************************/
 /**
  * @brief Configures the direction (input or output) and mode of a specific pin of a specific port in a microcontroller.
@@ -207,6 +226,137 @@ Std_ReturnType MCAL_GPIO_AtomicResetPin(u8 Copy_PortID , u8 Copy_PinID );
  *      @endcode
  */
 Std_ReturnType MCAL_GPIO_LCKPin(u8 Copy_PortID , u8 Copy_PinID ,u8 Copy_PinState);
+/**
+ * @brief Writes a group of pins of a specific port with a single store.
+ *
+ * This function updates every pin selected by the mask to the matching bit of the value by writing one word to the BSRR register.
+ * Pins outside the mask are left untouched, and the selected pins change together in the same bus cycle, so no glitch is seen on a parallel bus.
+ *
+ * @param[in] Copy_PortID An 8-bit unsigned integer that represents the port. This parameter should be one of the following options: GPIO_PORTA, GPIO_PORTB, or GPIO_PORTC.
+ * @param[in] Copy_Mask A 16-bit mask where bit n set means pin n will be written.
+ * @param[in] Copy_Value A 16-bit value where bit n is the new level of pin n. Bits outside the mask are ignored.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ *
+ * @par Example:
+ *      To drive pins 6..9 of port A with the nibble 0b1010 (pins 7 and 9 high, pins 6 and 8 low):
+ *      @code
+ *      MCAL_GPIO_SetPortValueMasked(GPIO_PORTA, 0x03C0, (0b1010 << 6));
+ *      @endcode
+ */
+Std_ReturnType MCAL_GPIO_SetPortValueMasked(u8 Copy_PortID , u16 Copy_Mask , u16 Copy_Value);
+/**
+ * @brief Reads a group of pins of a specific port with a single load.
+ *
+ * This function reads the IDR register once and returns only the pins selected by the mask, kept at their original bit positions.
+ *
+ * @param[in] Copy_PortID An 8-bit unsigned integer that represents the port. This parameter should be one of the following options: GPIO_PORTA, GPIO_PORTB, or GPIO_PORTC.
+ * @param[in] Copy_Mask A 16-bit mask where bit n set means pin n will be read.
+ * @param[out] Copy_PortReturnValue A 16-bit unsigned integer pointer that receives (IDR & Copy_Mask).
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ *
+ * @par Example:
+ *      To read pins 0..3 of port B:
+ *      @code
+ *      u16 PortValue;
+ *      MCAL_GPIO_GetPortValueMasked(GPIO_PORTB, 0x000F, &PortValue);
+ *      @endcode
+ */
+Std_ReturnType MCAL_GPIO_GetPortValueMasked(u8 Copy_PortID , u16 Copy_Mask , u16 *Copy_PortReturnValue);
+/**
+ * @brief Applies a whole pin configuration table with at most three register writes per port.
+ *
+ * This function folds every entry of the table into the final CRL, CRH and ODR images of each port, then commits each port with
+ * one BSRR write (initial levels) followed by one CRL write and one CRH write. Registers of a port that no entry touches are not written,
+ * and pins that are not listed in the table keep their current configuration. The levels are written before the modes so outputs
+ * come up directly at their initial level.
+ *
+ * @param[in] Copy_PinCfgTable A pointer to a table of GPIO_PinCfg_t entries, normally a const table in flash.
+ * @param[in] Copy_PinCfgCount The number of entries in the table.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens. If any entry is invalid nothing is written.
+ *
+ * @note The clocks of the used ports must be enabled before calling this function.
+ *
+ * @par Example:
+ *      @code
+ *      static const GPIO_PinCfg_t Board_PinMap[] =
+ *      {
+ *          { GPIO_PORTA, GPIO_PIN0, GPIO_OUTPUT_LOW_SPEED_PUSHPULL, GPIO_LOW  },
+ *          { GPIO_PORTA, GPIO_PIN1, GPIO_INPUT_PULL_UP_MODE,        GPIO_HIGH },
+ *          { GPIO_PORTB, GPIO_PIN12, GPIO_INPUT_FLOATING_MODE,      GPIO_LOW  },
+ *      };
+ *      MCAL_GPIO_ApplyConfigTable(Board_PinMap, sizeof(Board_PinMap) / sizeof(Board_PinMap[0]));
+ *      @endcode
+ */
+Std_ReturnType MCAL_GPIO_ApplyConfigTable(const GPIO_PinCfg_t *Copy_PinCfgTable , u8 Copy_PinCfgCount);
+/**
+ * @brief Initializes the debounce service.
+ *
+ * This function seeds the debounced state of every port enabled in GPIO_config.h (GPIO_DEBOUNCE_PORTx_MASK) with the current
+ * IDR value and clears the counters and the pending edges. Call it once after the pins are configured as inputs.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ */
+Std_ReturnType MCAL_GPIO_DebounceInit(void);
+/**
+ * @brief Runs one debounce scan over all enabled ports.
+ *
+ * This function reads the full IDR of every enabled port once and runs a bit-parallel vertical counter over the 16 pins, so a
+ * port costs a handful of ALU operations regardless of how many pins are filtered. A pin's stable state changes after
+ * GPIO_DEBOUNCE_SAMPLES consecutive samples at the new level, and the change is latched in the rising/falling edge masks.
+ *
+ * @note Call it at a fixed rate (typically 1..10 ms). It has the SYSTICK/GPT callback signature, so it can be passed directly:
+ *      @code
+ *      MCAL_GPIO_DebounceInit();
+ *      MCAL_SYSTICK_SetIntervalPeriodic(5000, MCAL_GPIO_DebounceTick);
+ *      @endcode
+ */
+void MCAL_GPIO_DebounceTick(void);
+/**
+ * @brief Gets the debounced level of the pins of a port.
+ *
+ * @param[in] Copy_PortID GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ * @param[out] Copy_StateReturnValue A 16-bit unsigned integer pointer that receives the debounced levels (bit n = pin n). Pins that are not debounced read 0.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ */
+Std_ReturnType MCAL_GPIO_DebounceGetState(u8 Copy_PortID , u16 *Copy_StateReturnValue);
+/**
+ * @brief Gets and clears the debounced edges of a port.
+ *
+ * This function returns every rising and falling edge accepted since the previous call and clears them, so no edge is lost or
+ * reported twice even if MCAL_GPIO_DebounceTick runs from an interrupt, as long as that interrupt is at or below
+ * SCB_CRITICAL_CEILING (the read-and-clear runs in an MCAL_SCB_EnterCritical section).
+ *
+ * @param[in] Copy_PortID GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ * @param[out] Copy_RisingReturnValue Receives the pins that went low->high (bit n = pin n). May be NULL if not needed.
+ * @param[out] Copy_FallingReturnValue Receives the pins that went high->low (bit n = pin n). May be NULL if not needed.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ *
+ * @par Example:
+ *      @code
+ *      u16 Pressed, Released;
+ *      MCAL_GPIO_DebounceGetEdges(GPIO_PORTB, &Released, &Pressed);    // active-low buttons
+ *      if( Pressed & (1 << GPIO_PIN12) ) { ... }
+ *      @endcode
+ */
+Std_ReturnType MCAL_GPIO_DebounceGetEdges(u8 Copy_PortID , u16 *Copy_RisingReturnValue , u16 *Copy_FallingReturnValue);
+/**
+ * @brief Gets the bus address of a data register of a port.
+ *
+ * This function is meant for bus masters such as the DMA, which need the peripheral address of IDR (sampling) or BSRR
+ * (atomic set/reset of any pin group in one transfer).
+ *
+ * @param[in] Copy_PortID GPIO_PORTA, GPIO_PORTB or GPIO_PORTC.
+ * @param[in] Copy_RegID GPIO_REG_IDR, GPIO_REG_ODR, GPIO_REG_BSRR or GPIO_REG_BRR.
+ * @param[out] Copy_AddressReturnValue Receives the register address.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ */
+Std_ReturnType MCAL_GPIO_GetPortRegAddress(u8 Copy_PortID , u8 Copy_RegID , u32 *Copy_AddressReturnValue);
 
 
 #endif /* MCAL_GPIO_INTERFACE_H_ */
\ No newline at end of file
@@ -21,6 +21,8 @@
 #define GPIO_PORTA_BASE_ADDRESS  0x40010800U
 #define GPIO_PORTB_BASE_ADDRESS  0x40010C00U
 #define GPIO_PORTC_BASE_ADDRESS  0x40011000U
+
+#define GPIO_PORTS_COUNT         3
 /*
 #define GPIO_PORTD_BASE_ADDRESS  0x40011400U
 #define GPIO_PORTE_BASE_ADDRESS  0x40011800U
@@ -53,4 +55,24 @@ typedef struct GPIO_REGISTERS
 
 #define LCKK        16
 
+#define GPIO_BSRR_RESET_SHIFT   16
+
+/******************************************< DEBOUNCE SERVICE ******************************************/
+/* Samples needed before a level change is accepted; fixed by the 2-bit vertical counter */
+#define GPIO_DEBOUNCE_SAMPLES   4
+/**
+ * @brief Debounce state of one port, one bit per pin.
+ *
+ * Cnt1:Cnt0 form a 2-bit counter per pin ("vertical" counter: bit 1 of all 16 counters in Cnt1, bit 0 in Cnt0).
+ * The counter runs while the sample differs from State and the state flips when it wraps back to zero.
+ */
+typedef struct
+{
+    u16 State;      /* Debounced level of each pin                          */
+    u16 Cnt0;       /* Bit 0 of the per-pin counters                        */
+    u16 Cnt1;       /* Bit 1 of the per-pin counters                        */
+    u16 Rising;     /* Accepted low->high edges not yet read by the user    */
+    u16 Falling;    /* Accepted high->low edges not yet read by the user    */
+}GPIO_Debounce_t;
+
 #endif /* MCAL_GPIO_PRIVATE_H_ */
\ No newline at end of file
@@ -75,6 +75,32 @@
  *     - Sub-Priority Range: 0 to 15
  */
 #define NVIC_PRIORITY_GROUPS    NVIC_4GROUP_4SUB
+/**
+ * @brief RAM Vector Table
+ *
+ * - NVIC_RAM_VECTORS_ENABLED : MCAL_NVIC_RelocateVectorTable copies the vector table into an aligned SRAM array and
+ *   points SCB_VTOR at it, after which MCAL_NVIC_AttachISR installs handlers directly in the table.
+ *   Costs (16 + NUMBER_OF_INTERRUPTS) * 4 bytes of SRAM, placed on a NVIC_RAM_VECTORS_ALIGNMENT boundary.
+ * - NVIC_RAM_VECTORS_DISABLED: the flash table is used as linked; the attach functions return E_NOT_OK.
+ */
+#define NVIC_RAM_VECTORS        NVIC_RAM_VECTORS_DISABLED
+/**
+ * @brief Interrupt Statistics
+ *
+ * - NVIC_IRQ_STATS_ENABLED : the EXTI, GPT and SysTick handlers time their own execution with the DWT cycle counter
+ *   and record count, last/min/max cycles and a log2 histogram of them for the sources listed in NVIC_STATS_SOURCES.
+ *   The entry latency before the handler starts is not measured.
+ * - NVIC_IRQ_STATS_DISABLED: the NVIC_STATS_ENTER / NVIC_STATS_EXIT hooks compile to nothing.
+ *
+ * NVIC_STATS_SOURCES lists the tracked IRQn numbers (NVIC_STATS_SYSTICK for the SysTick exception); each costs
+ * 48 bytes of SRAM. Sources not listed are ignored by the hooks.
+ *
+ * @note This file only holds macros, so the driver files include it (through NVIC_stats.h) to see the switch.
+ */
+#define NVIC_IRQ_STATS          NVIC_IRQ_STATS_DISABLED
+#define NVIC_STATS_SOURCES      { NVIC_EXTI0_IRQn , NVIC_EXTI1_IRQn , NVIC_EXTI2_IRQn , NVIC_EXTI3_IRQn , NVIC_EXTI4_IRQn ,  \
+                                  NVIC_EXTI9_5_IRQn , NVIC_EXTI15_10_IRQn , NVIC_TIM1_UP_IRQn , NVIC_TIM2_IRQn ,           \
+                                  NVIC_TIM3_IRQn , NVIC_TIM4_IRQn , NVIC_USART1_IRQn , NVIC_USART2_IRQn , NVIC_STATS_SYSTICK }
 
 /**
  * @} User_Configuration
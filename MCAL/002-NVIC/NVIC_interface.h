@@ -35,6 +35,41 @@
  *       Software Interface Standard) header file.
  */
 typedef u8 IRQn_Type;
+/**
+ * @brief One entry of a priority table applied by MCAL_NVIC_ApplyPriorityTable.
+ */
+typedef struct
+{
+    IRQn_Type IRQn;     /**< Interrupt number                                                                     */
+    u8 Priority;        /**< Priority number 0 (most urgent) to MAX_PRIORITY, split into group/sub by the grouping */
+}NVIC_PriorityCfg_t;
+/**
+ * @brief Interrupt Execution-Time Statistics
+ * @{
+ */
+#define NVIC_IRQ_STATS_DISABLED     0
+#define NVIC_IRQ_STATS_ENABLED      1
+#define NVIC_STATS_SYSTICK          0xFF    /**< Source ID of the SysTick exception          */
+#define NVIC_STATS_EXEC_BINS        16      /**< Bin n counts runs of 2^n to 2^(n+1)-1 cycles; the last bin also holds longer runs */
+/**
+ * @brief Execution-time statistics of one interrupt source, in CPU cycles (SYSTEM_CLOCK_FREQUENCY).
+ *
+ * Every figure is the time the handler body ran, callbacks included. The entry latency (from the interrupt pending
+ * to the first instruction of the handler) is not measured.
+ */
+typedef struct
+{
+    u32 Count;                                  /**< Handler runs                          */
+    u32 LastExecCycles;                         /**< Execution time of the last run        */
+    u32 MinExecCycles;                          /**< Shortest run (0xFFFFFFFF before any)  */
+    u32 MaxExecCycles;                          /**< Longest run                           */
+    u16 ExecHistogram[NVIC_STATS_EXEC_BINS];    /**< log2 histogram of the execution times, saturating */
+}NVIC_IRQExecStats_t;
+/** @} */
+/**
+ * @brief Interrupt handler installed in the RAM vector table.
+ */
+typedef void (*NVIC_ISR_t)(void);
 /**
  * @} (end of NVIC_Types NVIC Type Definitions)
  */
@@ -210,7 +245,9 @@ Std_ReturnType MCAL_NVIC_GetActiveIRQ(IRQn_Type Copy_IRQn , u8* ActiveIRQ);
  * This function sets the priority of the specified interrupt in the NVIC.
  *
  * @param[in] Copy_IRQn     The interrupt number (IRQn_Type) to set the priority for.
- * @param[in] Copy_Priority The priority level to set (0 to 255, with 0 being the highest).
+ * @param[in] Copy_Priority The priority level to set (0 to 15, with 0 being the highest).
+ *
+ * The 4-bit priority is split into group and sub-priority by NVIC_PRIORITY_GROUPS (NVIC_config.h), which is applied.
  *
  * @return Std_ReturnType
  *   - E_OK     : Priority set successfully.
@@ -259,6 +296,140 @@ Std_ReturnType MCAL_NVIC_vSetPriority(IRQn_Type Copy_IRQn , u8 Copy_GroupPriorit
  *   - E_NOT_OK : An error occurred (invalid interrupt number or Copy_Priority pointer is NULL).
  */
 Std_ReturnType MCAL_NVIC_GetPriority(IRQn_Type Copy_IRQn , u8* Priority);
+/**
+ * @brief Sets the priorities of several interrupts from a table, typically a const table in flash.
+ *
+ * Every entry is checked first; if one is invalid nothing is written. Each priority is then stored into its own 8-bit
+ * IPR field, leaving the other interrupts untouched. The priority grouping is set from NVIC_PRIORITY_GROUPS.
+ *
+ * @param[in] Copy_Table Table of {IRQn, Priority} entries.
+ * @param[in] Copy_Count Number of entries.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : All priorities set.
+ *   - E_NOT_OK : NULL table, or an entry with an invalid interrupt number or a priority above MAX_PRIORITY.
+ *
+ * @code
+ * static const NVIC_PriorityCfg_t App_Priorities[] =
+ * {
+ *     { NVIC_TIM1_UP_IRQn , 0 },  /// motor control, above the SCB_CRITICAL_CEILING
+ *     { NVIC_EXTI0_IRQn   , 8 },
+ *     { NVIC_USART1_IRQn  , 12 },
+ * };
+ * MCAL_NVIC_ApplyPriorityTable(App_Priorities, sizeof(App_Priorities) / sizeof(App_Priorities[0]));
+ * @endcode
+ */
+Std_ReturnType MCAL_NVIC_ApplyPriorityTable(const NVIC_PriorityCfg_t *Copy_Table , u8 Copy_Count);
+/**
+ * @brief Starts the DWT cycle counter and clears the statistics of every source in NVIC_STATS_SOURCES.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Statistics running.
+ *   - E_NOT_OK : NVIC_IRQ_STATS is NVIC_IRQ_STATS_DISABLED, or NVIC_STATS_SOURCES holds an invalid source.
+ */
+Std_ReturnType MCAL_NVIC_StatsInit(void);
+/**
+ * @brief Records the execution time of one handler run; called by NVIC_STATS_EXIT (see NVIC_stats.h), not by the application.
+ *
+ * @param[in] Copy_SourceID IRQn, or NVIC_STATS_SYSTICK.
+ * @param[in] Copy_Cycles Execution time of the run in cycles.
+ */
+void MCAL_NVIC_StatsRecordExec(u8 Copy_SourceID , u32 Copy_Cycles);
+/**
+ * @brief Reads the execution-time statistics of one source.
+ *
+ * The copy is not atomic against the handler of that source; read it again if Count changed meanwhile.
+ *
+ * @param[in] Copy_SourceID IRQn, or NVIC_STATS_SYSTICK.
+ * @param[out] Copy_Stats Receives the statistics.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Statistics copied.
+ *   - E_NOT_OK : Source not tracked, NULL pointer, or statistics disabled.
+ */
+Std_ReturnType MCAL_NVIC_GetExecStats(u8 Copy_SourceID , NVIC_IRQExecStats_t *Copy_Stats);
+/**
+ * @brief Clears the execution-time statistics of every tracked source.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Statistics cleared.
+ *   - E_NOT_OK : Statistics disabled.
+ */
+Std_ReturnType MCAL_NVIC_ResetExecStats(void);
+/**
+ * @brief Serializes the execution-time statistics of every tracked source into a compact binary record, e.g. to send over USART.
+ *
+ * Format (little endian): 0x53 'S', 0x54 'T', record count (u8), bin count (u8), then per source:
+ * IRQn (u8, 0xFF = SysTick) | Count | LastExecCycles | MinExecCycles | MaxExecCycles (u32 each) | ExecHistogram (u16 per bin).
+ *
+ * @param[out] Copy_Buffer Receives the dump.
+ * @param[in] Copy_BufferSize Size of Copy_Buffer in bytes.
+ * @param[out] Copy_Length Receives the number of bytes written.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Dump written.
+ *   - E_NOT_OK : NULL pointer, buffer too small, or statistics disabled.
+ */
+Std_ReturnType MCAL_NVIC_DumpExecStats(u8 *Copy_Buffer , u16 Copy_BufferSize , u16 *Copy_Length);
+/**
+ * @brief Moves the vector table to SRAM.
+ *
+ * Copies the active table (stack pointer, system exceptions and the NUMBER_OF_INTERRUPTS IRQ vectors) to an aligned
+ * SRAM array and points SCB_VTOR at it, so the handlers already linked keep working. Empty IRQ slots, and IRQ slots
+ * still pointing at the startup file's Default_Handler loop, get the default handler, which disables and records a
+ * stray interrupt instead of hanging. The system exception vectors are copied as they are. Calling it again once
+ * relocated does nothing.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : The table is in SRAM.
+ *   - E_NOT_OK : NVIC_RAM_VECTORS is NVIC_RAM_VECTORS_DISABLED in NVIC_config.h.
+ */
+Std_ReturnType MCAL_NVIC_RelocateVectorTable(void);
+/**
+ * @brief Installs a handler directly in the RAM vector table.
+ *
+ * The core then branches straight to Copy_ISR on the interrupt, without a driver handler calling a stored callback,
+ * saving a call, a stack frame and a pointer load per interrupt. The handler replaces the driver's one for that
+ * vector, so it must clear the peripheral's flags itself.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type).
+ * @param[in] Copy_ISR  The handler; NULL installs the default handler.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Handler installed.
+ *   - E_NOT_OK : Invalid interrupt number, table not relocated, or RAM vectors disabled.
+ *
+ * @code
+ * MCAL_NVIC_RelocateVectorTable();
+ * MCAL_NVIC_AttachISR(NVIC_TIM2_IRQn, MotorControl_ISR);
+ * MCAL_NVIC_EnableIRQ(NVIC_TIM2_IRQn);
+ * @endcode
+ */
+Std_ReturnType MCAL_NVIC_AttachISR(IRQn_Type Copy_IRQn , NVIC_ISR_t Copy_ISR);
+/**
+ * @brief Puts the default handler back on a vector.
+ *
+ * The default handler disables the interrupt that entered it (so an unserved level-triggered source cannot lock the
+ * core up) and records it; see MCAL_NVIC_GetUnhandledIRQ.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Default handler installed.
+ *   - E_NOT_OK : Invalid interrupt number, table not relocated, or RAM vectors disabled.
+ */
+Std_ReturnType MCAL_NVIC_DetachISR(IRQn_Type Copy_IRQn);
+/**
+ * @brief Reports interrupts that reached the default handler.
+ *
+ * @param[out] Copy_LastIRQn Receives the last interrupt number served by the default handler.
+ * @param[out] Copy_Count    Receives how many times the default handler ran.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Values read.
+ *   - E_NOT_OK : NULL pointer, or RAM vectors disabled.
+ */
+Std_ReturnType MCAL_NVIC_GetUnhandledIRQ(IRQn_Type *Copy_LastIRQn , u32 *Copy_Count);
 
 
 
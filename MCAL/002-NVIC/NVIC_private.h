@@ -63,6 +63,14 @@
  * @brief NVIC IPR Base Address
  */     
 #define NVIC_IPR_Base_Address   (((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x300))))
+/**
+ * @brief NVIC IPR byte access: one 8-bit priority field per interrupt, so a store never touches the neighbours
+ */
+#define NVIC_IPR_BYTE(IRQn)     (((volatile u8 *)((NVIC_BASE_ADDRESS) + (0x300)))[(IRQn)])
+/**
+ * @brief Implemented priority bits (upper 4 bits of each field)
+ */
+#define NVIC_PRIORITY_SHIFT     4
 /**
  * @brief NVIC STIR Base Address
  */  
@@ -76,6 +84,36 @@
 #define NVIC_4GROUP_4SUB        0x05FA0500U 
 #define NVIC_2GROUP_8SUB        0x05FA0600U 
 #define NVIC_0GROUP_16SUB       0x05FA0700U 
+/**
+ * @brief Distance between two group priorities in 4-bit priority numbers (PRIGROUP 3 -> 1 .. PRIGROUP 7 -> 16)
+ */
+#define NVIC_GROUP_STEP(GROUPING)   (1 << ((((GROUPING) >> 8) & 0x7) - 3))
+
+/**
+ * @brief RAM Vector Table
+ * @{
+ */
+#define NVIC_RAM_VECTORS_DISABLED   0
+#define NVIC_RAM_VECTORS_ENABLED    1
+/**< Stack pointer, reset and the 14 system exception slots precede the IRQ vectors */
+#define NVIC_CORE_VECTORS           16
+#define NVIC_VECTORS_COUNT          (NVIC_CORE_VECTORS + NUMBER_OF_INTERRUPTS)
+/**< VTOR needs the table aligned to its size rounded up to a power of two: 76 vectors * 4 bytes -> 512 */
+#define NVIC_RAM_VECTORS_ALIGNMENT  512
+/** @} */
+
+/**
+ * @brief Interrupt Statistics
+ * @{
+ */
+/**< Slot of the SysTick exception in the source map, after the IRQs */
+#define NVIC_STATS_MAP_SIZE         (NUMBER_OF_INTERRUPTS + 1)
+/**< Binary dump: 'S' 'T' | record count | bin count, then per record IRQn (u8), Count, Last, Min, Max (u32) and bins (u16) */
+#define NVIC_STATS_DUMP_SYNC0       0x53
+#define NVIC_STATS_DUMP_SYNC1       0x54
+#define NVIC_STATS_DUMP_HEADER      4
+#define NVIC_STATS_DUMP_RECORD      (1 + (4 * 4) + (NVIC_STATS_EXEC_BINS * 2))
+/** @} */
 
 /**
  * @} (end of group NVIC_Registers)
@@ -18,9 +18,43 @@
 #include "BIT_MATH.h"
 /**************************************** MCAL *****************************************************/
 #include "SCB_interface.h"
+#include "SCB_config.h"
 #include "NVIC_interface.h"
 #include "NVIC_private.h"
 #include "NVIC_config.h"
+/* BASEPRI only compares group priorities, so the critical ceiling must sit on a group boundary */
+#if NVIC_PRIORITY_GROUPS == NVIC_0GROUP_16SUB
+    #error "SCB_CRITICAL_CEILING needs group priority bits, NVIC_0GROUP_16SUB has none"
+#elif ( (SCB_CRITICAL_CEILING % NVIC_GROUP_STEP(NVIC_PRIORITY_GROUPS)) != 0 )
+    #error "SCB_CRITICAL_CEILING must be a multiple of the group priority step of NVIC_PRIORITY_GROUPS"
+#endif
+/**************************************** Global Variables Section *****************************************************/
+#if NVIC_RAM_VECTORS == NVIC_RAM_VECTORS_ENABLED
+#if ( (NVIC_VECTORS_COUNT * 4) > NVIC_RAM_VECTORS_ALIGNMENT )
+    #error "NVIC_RAM_VECTORS_ALIGNMENT is smaller than the vector table"
+#endif
+static NVIC_ISR_t NVIC_RamVectors[NVIC_VECTORS_COUNT] __attribute__((aligned(NVIC_RAM_VECTORS_ALIGNMENT)));
+static u8 NVIC_RamVectorsActive = 0;
+static volatile IRQn_Type NVIC_UnhandledLastIRQn = 0;
+static volatile u32 NVIC_UnhandledCount = 0;
+/* Endless loop of the startup file; every vector the application does not define is a weak alias of it */
+extern void Default_Handler(void);
+/**************************************** Static Functions Section *****************************************************/
+static void NVIC_voidDefaultHandler(void);
+#elif NVIC_RAM_VECTORS != NVIC_RAM_VECTORS_DISABLED
+    #error "Wrong NVIC_RAM_VECTORS configuration"
+#endif
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+static const u8 NVIC_StatsSources[] = NVIC_STATS_SOURCES;
+#define NVIC_STATS_SLOTS    ( sizeof(NVIC_StatsSources) / sizeof(NVIC_StatsSources[0]) )
+static NVIC_IRQExecStats_t NVIC_Stats[NVIC_STATS_SLOTS];
+/* Source -> slot + 1; 0 (the reset value) means not tracked, so the hooks ignore every source until StatsInit */
+static u8 NVIC_StatsSlot[NVIC_STATS_MAP_SIZE] = {0};
+/**************************************** Static Functions Section *****************************************************/
+static u8 NVIC_u8StatsMapIndex(u8 Copy_SourceID);
+static void NVIC_voidStatsClear(void);
+static u8 *NVIC_pu8PutU32(u8 *Copy_Buffer , u32 Copy_Value);
+#endif
 /*====================================================   Start_FUNCTION   ====================================================*/
 Std_ReturnType MCAL_NVIC_EnableIRQ(IRQn_Type Copy_IRQn)
 {
@@ -188,8 +222,8 @@ Std_ReturnType MCAL_NVIC_xSetPriority(IRQn_Type Copy_IRQn , u32 Copy_Priority)
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
     if (Copy_IRQn < NUMBER_OF_INTERRUPTS && Copy_Priority <= MAX_PRIORITY)
     {
-        NVIC_IPR_Base_Address[Copy_IRQn / 4] = ((Copy_Priority << ((Copy_IRQn % 4)*8))<<4) ;
-        MCAL_SCB_SetPriorityGrouping(NVIC_0GROUP_16SUB);
+        NVIC_IPR_BYTE(Copy_IRQn) = (u8)(Copy_Priority << NVIC_PRIORITY_SHIFT);
+        MCAL_SCB_SetPriorityGrouping(NVIC_PRIORITY_GROUPS);
         Local_FunctionStatus = E_OK;
     }
     else
@@ -231,7 +265,7 @@ Std_ReturnType MCAL_NVIC_vSetPriority(IRQn_Type Copy_IRQn , u8 Copy_GroupPriorit
     #endif
     if( Copy_IRQn > 0 && Copy_GroupPriority < NVIC_MAX_GROUP_PRIORITY && Copy_SubPriority < NVIC_MAX_SUB_PRIORITY)
     {
-        NVIC_IPR_Base_Address[Copy_IRQn / 4] = ((Copy_GroupPriority << (((Copy_IRQn % 4) * 8))<<4)) ;
+        NVIC_IPR_BYTE(Copy_IRQn) = (u8)(Copy_GroupPriority << NVIC_PRIORITY_SHIFT);
         Local_FunctionStatus = E_OK;
     }
     else{
@@ -250,9 +284,317 @@ Std_ReturnType MCAL_NVIC_GetPriority(IRQn_Type Copy_IRQn , u8* Priority)
     {
         return Local_FunctionStatus;
     }
-    u8* Local_PriorityREG= (u8*) &NVIC_IPR_Base_Address[Copy_IRQn / 4];
-    *Priority = ( ( Local_PriorityREG[Copy_IRQn % 4] >> ((Copy_IRQn % 4) * 8 )) >> 4);
+    *Priority = (u8)(NVIC_IPR_BYTE(Copy_IRQn) >> NVIC_PRIORITY_SHIFT);
     Local_FunctionStatus = E_OK;
     return Local_FunctionStatus;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_ApplyPriorityTable(const NVIC_PriorityCfg_t *Copy_Table , u8 Copy_Count)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u8 Local_Entry;
+    if (Copy_Table != NULL)
+    {
+        Local_FunctionStatus = E_OK;
+        for (Local_Entry = 0; Local_Entry < Copy_Count; Local_Entry++)
+        {
+            if ( (Copy_Table[Local_Entry].IRQn >= NUMBER_OF_INTERRUPTS) || (Copy_Table[Local_Entry].Priority > MAX_PRIORITY) )
+            {
+                Local_FunctionStatus = E_NOT_OK;
+            }
+        }
+    }
+    if (Local_FunctionStatus == E_OK)
+    {
+        for (Local_Entry = 0; Local_Entry < Copy_Count; Local_Entry++)
+        {
+            NVIC_IPR_BYTE(Copy_Table[Local_Entry].IRQn) = (u8)(Copy_Table[Local_Entry].Priority << NVIC_PRIORITY_SHIFT);
+        }
+        MCAL_SCB_SetPriorityGrouping(NVIC_PRIORITY_GROUPS);
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_StatsInit(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+    u8 Local_Slot, Local_Index;
+    Local_FunctionStatus = E_OK;
+    for (Local_Slot = 0; Local_Slot < NVIC_STATS_SLOTS; Local_Slot++)
+    {
+        if (NVIC_u8StatsMapIndex(NVIC_StatsSources[Local_Slot]) >= NVIC_STATS_MAP_SIZE)
+        {
+            Local_FunctionStatus = E_NOT_OK;
+        }
+    }
+    if (Local_FunctionStatus == E_OK)
+    {
+        MCAL_SCB_StartCycleCounter();
+        NVIC_voidStatsClear();
+        for (Local_Slot = 0; Local_Slot < NVIC_STATS_SLOTS; Local_Slot++)
+        {
+            Local_Index = NVIC_u8StatsMapIndex(NVIC_StatsSources[Local_Slot]);
+            NVIC_StatsSlot[Local_Index] = (u8)(Local_Slot + 1);
+        }
+    }
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void MCAL_NVIC_StatsRecordExec(u8 Copy_SourceID , u32 Copy_Cycles)
+{
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+    NVIC_IRQExecStats_t *Local_Stats;
+    u8 Local_Index = NVIC_u8StatsMapIndex(Copy_SourceID);
+    u8 Local_Bin;
+    if ( (Local_Index < NVIC_STATS_MAP_SIZE) && (NVIC_StatsSlot[Local_Index] != 0) )
+    {
+        Local_Stats = &NVIC_Stats[NVIC_StatsSlot[Local_Index] - 1];
+        Local_Stats->Count++;
+        Local_Stats->LastExecCycles = Copy_Cycles;
+        if (Copy_Cycles < Local_Stats->MinExecCycles)
+        {
+            Local_Stats->MinExecCycles = Copy_Cycles;
+        }
+        if (Copy_Cycles > Local_Stats->MaxExecCycles)
+        {
+            Local_Stats->MaxExecCycles = Copy_Cycles;
+        }
+        /* floor(log2(cycles)) with one CLZ; 0 and 1 cycle both land in bin 0 */
+        Local_Bin = (u8)( 31 - __builtin_clz(Copy_Cycles | 1) );
+        if (Local_Bin >= NVIC_STATS_EXEC_BINS)
+        {
+            Local_Bin = NVIC_STATS_EXEC_BINS - 1;
+        }
+        if (Local_Stats->ExecHistogram[Local_Bin] != 0xFFFF)
+        {
+            Local_Stats->ExecHistogram[Local_Bin]++;
+        }
+    }
+#else
+    (void)Copy_SourceID;
+    (void)Copy_Cycles;
+#endif
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_GetExecStats(u8 Copy_SourceID , NVIC_IRQExecStats_t *Copy_Stats)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+    u8 Local_Index = NVIC_u8StatsMapIndex(Copy_SourceID);
+    if ( (Copy_Stats != NULL) && (Local_Index < NVIC_STATS_MAP_SIZE) && (NVIC_StatsSlot[Local_Index] != 0) )
+    {
+        *Copy_Stats = NVIC_Stats[NVIC_StatsSlot[Local_Index] - 1];
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_SourceID;
+    (void)Copy_Stats;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_ResetExecStats(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+    NVIC_voidStatsClear();
+    Local_FunctionStatus = E_OK;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_DumpExecStats(u8 *Copy_Buffer , u16 Copy_BufferSize , u16 *Copy_Length)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+    u8 *Local_Write = Copy_Buffer;
+    NVIC_IRQExecStats_t Local_Stats;
+    if ( (Copy_Buffer != NULL) && (Copy_Length != NULL) &&
+         (Copy_BufferSize >= (NVIC_STATS_DUMP_HEADER + (NVIC_STATS_SLOTS * NVIC_STATS_DUMP_RECORD))) )
+    {
+        *Local_Write++ = NVIC_STATS_DUMP_SYNC0;
+        *Local_Write++ = NVIC_STATS_DUMP_SYNC1;
+        *Local_Write++ = (u8)NVIC_STATS_SLOTS;
+        *Local_Write++ = NVIC_STATS_EXEC_BINS;
+        for (u8 Local_Slot = 0; Local_Slot < NVIC_STATS_SLOTS; Local_Slot++)
+        {
+            Local_Stats = NVIC_Stats[Local_Slot];
+            *Local_Write++ = NVIC_StatsSources[Local_Slot];
+            Local_Write = NVIC_pu8PutU32(Local_Write , Local_Stats.Count);
+            Local_Write = NVIC_pu8PutU32(Local_Write , Local_Stats.LastExecCycles);
+            Local_Write = NVIC_pu8PutU32(Local_Write , Local_Stats.MinExecCycles);
+            Local_Write = NVIC_pu8PutU32(Local_Write , Local_Stats.MaxExecCycles);
+            for (u8 Local_Bin = 0; Local_Bin < NVIC_STATS_EXEC_BINS; Local_Bin++)
+            {
+                *Local_Write++ = (u8)(Local_Stats.ExecHistogram[Local_Bin]);
+                *Local_Write++ = (u8)(Local_Stats.ExecHistogram[Local_Bin] >> 8);
+            }
+        }
+        *Copy_Length = (u16)(Local_Write - Copy_Buffer);
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_Buffer;
+    (void)Copy_BufferSize;
+    (void)Copy_Length;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_RelocateVectorTable(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if NVIC_RAM_VECTORS == NVIC_RAM_VECTORS_ENABLED
+    u32 Local_TableAddress = 0;
+    const NVIC_ISR_t *Local_ActiveTable;
+    if (NVIC_RamVectorsActive == 0)
+    {
+        MCAL_SCB_GetVectorTable(&Local_TableAddress);
+        Local_ActiveTable = (const NVIC_ISR_t *)Local_TableAddress;
+        for (u8 Local_Vector = 0; Local_Vector < NVIC_VECTORS_COUNT; Local_Vector++)
+        {
+            NVIC_RamVectors[Local_Vector] = Local_ActiveTable[Local_Vector];
+            /* Empty, reserved and unused IRQ slots: the startup loop would hang on a stray interrupt */
+            if ( (Local_Vector >= NVIC_CORE_VECTORS)
+              && ((NVIC_RamVectors[Local_Vector] == NULL) || (NVIC_RamVectors[Local_Vector] == Default_Handler)) )
+            {
+                NVIC_RamVectors[Local_Vector] = NVIC_voidDefaultHandler;
+            }
+        }
+        Local_FunctionStatus = MCAL_SCB_SetVectorTable( (u32)NVIC_RamVectors );
+        if (Local_FunctionStatus == E_OK)
+        {
+            NVIC_RamVectorsActive = 1;
+        }
+    }else
+    {
+        Local_FunctionStatus = E_OK;
+    }
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_AttachISR(IRQn_Type Copy_IRQn , NVIC_ISR_t Copy_ISR)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if NVIC_RAM_VECTORS == NVIC_RAM_VECTORS_ENABLED
+    if ( (Copy_IRQn < NUMBER_OF_INTERRUPTS) && (NVIC_RamVectorsActive == 1) )
+    {
+        NVIC_RamVectors[NVIC_CORE_VECTORS + Copy_IRQn] = (Copy_ISR != NULL) ? Copy_ISR : NVIC_voidDefaultHandler;
+        /* The vector fetch of an interrupt that is already pending must see the new entry */
+        __asm volatile ("dsb" : : : "memory");
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_IRQn;
+    (void)Copy_ISR;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_DetachISR(IRQn_Type Copy_IRQn)
+{
+    return MCAL_NVIC_AttachISR(Copy_IRQn , NULL);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_NVIC_GetUnhandledIRQ(IRQn_Type *Copy_LastIRQn , u32 *Copy_Count)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if NVIC_RAM_VECTORS == NVIC_RAM_VECTORS_ENABLED
+    if ( (Copy_LastIRQn != NULL) && (Copy_Count != NULL) )
+    {
+        *Copy_LastIRQn = NVIC_UnhandledLastIRQn;
+        *Copy_Count = NVIC_UnhandledCount;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_LastIRQn;
+    (void)Copy_Count;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#if NVIC_RAM_VECTORS == NVIC_RAM_VECTORS_ENABLED
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Handler of every vector without an attached ISR.
+ *
+ * The active exception number is read from IPSR; the interrupt is disabled so that a source nobody serves cannot keep
+ * re-entering, and it is recorded for MCAL_NVIC_GetUnhandledIRQ.
+ */
+static void NVIC_voidDefaultHandler(void)
+{
+    u32 Local_IPSR;
+    __asm volatile ("mrs %0, ipsr" : "=r" (Local_IPSR));
+    if (Local_IPSR >= NVIC_CORE_VECTORS)
+    {
+        MCAL_NVIC_DisableIRQ( (IRQn_Type)(Local_IPSR - NVIC_CORE_VECTORS) );
+        NVIC_UnhandledLastIRQn = (IRQn_Type)(Local_IPSR - NVIC_CORE_VECTORS);
+    }
+    NVIC_UnhandledCount++;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#endif
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Index of a source in the source map: the IRQn itself, SysTick after the last IRQ.
+ *        Returns NVIC_STATS_MAP_SIZE for an invalid source.
+ */
+static u8 NVIC_u8StatsMapIndex(u8 Copy_SourceID)
+{
+    u8 Local_Index = NVIC_STATS_MAP_SIZE;
+    if (Copy_SourceID == NVIC_STATS_SYSTICK)
+    {
+        Local_Index = NUMBER_OF_INTERRUPTS;
+    }else if (Copy_SourceID < NUMBER_OF_INTERRUPTS)
+    {
+        Local_Index = Copy_SourceID;
+    }
+    return Local_Index;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void NVIC_voidStatsClear(void)
+{
+    for (u8 Local_Slot = 0; Local_Slot < NVIC_STATS_SLOTS; Local_Slot++)
+    {
+        NVIC_Stats[Local_Slot] = (NVIC_IRQExecStats_t){ .MinExecCycles = 0xFFFFFFFF };
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static u8 *NVIC_pu8PutU32(u8 *Copy_Buffer , u32 Copy_Value)
+{
+    Copy_Buffer[0] = (u8)(Copy_Value);
+    Copy_Buffer[1] = (u8)(Copy_Value >> 8);
+    Copy_Buffer[2] = (u8)(Copy_Value >> 16);
+    Copy_Buffer[3] = (u8)(Copy_Value >> 24);
+    return Copy_Buffer + 4;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#endif
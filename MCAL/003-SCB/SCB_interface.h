@@ -6,6 +6,54 @@
 /****************************************************************/
 #ifndef SCB_INTERFACE_H_
 #define SCB_INTERFACE_H_
+/**
+ * @brief Deferred work item function; Copy_Arg is the argument given at post time.
+ */
+typedef void (*SCB_DeferredFunc_t)(void *Copy_Arg);
+/**
+ * @brief Driver callback type (no argument) that can be posted as it is.
+ */
+typedef void (*SCB_DeferredCallback_t)(void);
+/**
+ * @name Low-power control states (MCAL_SCB_SetSleepOnExit, MCAL_SCB_SetSevOnPend)
+ * @{
+ */
+#define SCB_LOW_POWER_DISABLE   0
+#define SCB_LOW_POWER_ENABLE    1
+/** @} */
+/**
+ * @name Reset causes (SCB_ResetInfo_t.Cause)
+ * @{
+ */
+#define SCB_RESET_CAUSE_UNKNOWN     0   /**< No RCC flag set (flags cleared and core-only reset from a debugger)  */
+#define SCB_RESET_CAUSE_POWER_ON    1   /**< Power-on / power-down: always a cold start                           */
+#define SCB_RESET_CAUSE_PIN         2   /**< NRST pin                                                             */
+#define SCB_RESET_CAUSE_SOFTWARE    3   /**< MCAL_SCB_SoftwareReset or any other SYSRESETREQ                      */
+#define SCB_RESET_CAUSE_IWDG        4   /**< Independent watchdog                                                 */
+#define SCB_RESET_CAUSE_WWDG        5   /**< Window watchdog                                                      */
+#define SCB_RESET_CAUSE_LOW_POWER   6   /**< Illegal Stop/Standby entry                                           */
+/** @} */
+/**
+ * @brief Reason of a reset that did not go through MCAL_SCB_SoftwareReset; the application uses 1..255.
+ */
+#define SCB_RESET_REASON_NONE       0
+/**
+ * @name Warm flags: state that survives a warm reset (MCAL_SCB_SetWarmFlags). All are clear after a cold start.
+ * @{
+ */
+#define SCB_WARM_LCD_READY          0x00000001  /**< The LCD controller is configured (set by LCD_Init)        */
+#define SCB_WARM_APP(N)             ( (u32)1 << (16 + (N)) )    /**< Application flags, N = 0..15              */
+/** @} */
+/**
+ * @brief What MCAL_SCB_InitResetService found at start-up.
+ */
+typedef struct
+{
+    u8 Cause;           /**< SCB_RESET_CAUSE_x                                                                  */
+    u8 Reason;          /**< Code given to MCAL_SCB_SoftwareReset, SCB_RESET_REASON_NONE for other causes       */
+    u8 Warm;            /**< 1 if the no-init block was valid and kept, 0 after a cold start                    */
+    u32 ResetCount;     /**< Warm resets since the last cold start                                              */
+}SCB_ResetInfo_t;
 /**
  * @brief Set the Priority Grouping in the System Control Block (SCB).
  *
@@ -99,4 +147,305 @@ Std_ReturnType MCAL_SCB_ClearMemFault();
  */
 Std_ReturnType MCAL_SCB_ClearUsageFault();
 
+/*****************************< Critical sections *****************************/
+/**
+ * @brief Enters a critical section by raising BASEPRI to SCB_CRITICAL_CEILING.
+ *
+ * Unlike DisableGlobalInterrupts, interrupts more urgent than the ceiling stay live. BASEPRI is only ever raised
+ * (BASEPRI_MAX), so sections nest: each exit restores the value saved by its own entry.
+ *
+ * @param[out] Copy_SavedState Receives the previous BASEPRI, to be passed to MCAL_SCB_ExitCritical.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (NULL pointer).
+ *
+ * @code
+ * u8 Local_State;
+ * MCAL_SCB_EnterCritical(&Local_State);
+ * /// update state shared with interrupts at or below the ceiling
+ * MCAL_SCB_ExitCritical(Local_State);
+ * @endcode
+ */
+Std_ReturnType MCAL_SCB_EnterCritical(u8 *Copy_SavedState);
+/**
+ * @brief Leaves a critical section, restoring the BASEPRI saved by the matching MCAL_SCB_EnterCritical.
+ *
+ * @param[in] Copy_SavedState The value returned by the matching MCAL_SCB_EnterCritical.
+ *
+ * @return Std_ReturnType E_OK.
+ */
+Std_ReturnType MCAL_SCB_ExitCritical(u8 Copy_SavedState);
+/**
+ * @brief Enters a critical section that masks every configurable interrupt (PRIMASK), for code that sleeps inside it.
+ *
+ * WFI is not woken by an interrupt masked by BASEPRI, but is woken by one masked by PRIMASK; its handler then runs at
+ * MCAL_SCB_ExitSleepCritical. Use MCAL_SCB_EnterCritical for everything else.
+ *
+ * @param[out] Copy_SavedState Receives the previous PRIMASK, to be passed to MCAL_SCB_ExitSleepCritical.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (NULL pointer).
+ */
+Std_ReturnType MCAL_SCB_EnterSleepCritical(u32 *Copy_SavedState);
+/**
+ * @brief Leaves a critical section, restoring the PRIMASK saved by the matching MCAL_SCB_EnterSleepCritical.
+ *
+ * @param[in] Copy_SavedState The value returned by the matching MCAL_SCB_EnterSleepCritical.
+ *
+ * @return Std_ReturnType E_OK.
+ */
+Std_ReturnType MCAL_SCB_ExitSleepCritical(u32 Copy_SavedState);
+/*****************************< Deferred work queue *****************************/
+/**
+ * @brief Sets PendSV to the lowest priority and empties the deferred work queue.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (SCB_DEFERRED_MODE disabled).
+ */
+Std_ReturnType MCAL_SCB_InitDeferred(void);
+/**
+ * @brief Queues a function to run later from PendSV, then pends PendSV.
+ *
+ * Safe to call from any interrupt priority and from thread mode: slots are reserved with LDREX/STREX, no interrupt is
+ * masked. Items run in reservation order once every higher-priority handler has returned.
+ *
+ * @param[in] Copy_Func Function to run.
+ * @param[in] Copy_Arg Argument passed to it.
+ *
+ * @return Std_ReturnType E_OK if queued, E_NOT_OK otherwise (NULL function, queue full or SCB_DEFERRED_MODE disabled).
+ */
+Std_ReturnType MCAL_SCB_PostDeferred(SCB_DeferredFunc_t Copy_Func , void *Copy_Arg);
+/**
+ * @brief Queues an argument-less driver callback; same rules as MCAL_SCB_PostDeferred.
+ *
+ * @param[in] Copy_Callback Callback to run.
+ *
+ * @return Std_ReturnType E_OK if queued, E_NOT_OK otherwise. Drivers run the callback immediately on E_NOT_OK.
+ */
+Std_ReturnType MCAL_SCB_PostDeferredCallback(SCB_DeferredCallback_t Copy_Callback);
+/**
+ * @brief Reports how many posts were refused because the queue was full.
+ *
+ * @param[out] Copy_Overflows Receives the count since start-up.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_SCB_GetDeferredOverflows(u32 *Copy_Overflows);
+/*****************************< Vector table *****************************/
+/**
+ * @brief Points the core at another vector table (SCB_VTOR).
+ *
+ * @param[in] Copy_TableAddress Address of the new table, in flash (0x08000000 region) or SRAM (0x20000000 region). It must
+ *                              be aligned to the table size rounded up to a power of two, 128 bytes at least.
+ *
+ * @return Std_ReturnType E_OK if the address is valid, E_NOT_OK otherwise (misaligned or outside code/SRAM).
+ */
+Std_ReturnType MCAL_SCB_SetVectorTable(u32 Copy_TableAddress);
+/**
+ * @brief Reads the address of the active vector table.
+ *
+ * @param[out] Copy_TableAddress Receives SCB_VTOR.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_SCB_GetVectorTable(u32 *Copy_TableAddress);
+/*****************************< Idle / sleep *****************************/
+/**
+ * @brief Prepares the event-driven idle: starts the DWT cycle counter, sets SEVONPEND and opens a new accounting window.
+ *
+ * SEVONPEND makes every interrupt that becomes pending a wake-up event, even one disabled in the NVIC, so driver waits
+ * only have to enable the peripheral interrupt source of the flag they poll.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (SCB_IDLE_MODE disabled).
+ */
+Std_ReturnType MCAL_SCB_InitIdle(void);
+/**
+ * @brief Sleeps (WFI) until an interrupt is pending.
+ *
+ * With SCB_IDLE_MODE enabled the sleep runs with PRIMASK set, so the time counted as idle stops when the interrupt
+ * pends and the handler runs right after, on return from this function.
+ *
+ * @return Std_ReturnType E_OK.
+ */
+Std_ReturnType MCAL_SCB_WaitForInterrupt(void);
+/**
+ * @brief Sleeps (WFE) until an event: SEV, an interrupt taken, or with SEVONPEND any interrupt becoming pending.
+ *
+ * Returns at once if the event register was already set, so a flag checked just before cannot be missed.
+ *
+ * @return Std_ReturnType E_OK.
+ */
+Std_ReturnType MCAL_SCB_WaitForEvent(void);
+/**
+ * @brief Wait step used by the drivers' blocking loops: `while (!flag) MCAL_SCB_BlockingWait();`.
+ *
+ * Sleeps in WFE once MCAL_SCB_InitIdle has run; returns at once otherwise, so the loop spins as it used to.
+ *
+ * @return Std_ReturnType E_OK if the core slept, E_NOT_OK otherwise (SCB_IDLE_MODE disabled or not initialized).
+ */
+Std_ReturnType MCAL_SCB_BlockingWait(void);
+/**
+ * @brief Replaces the final `for(;;);` of an application: sleeps in WFI forever, interrupts do the work.
+ *
+ * Combine with MCAL_SCB_SetSleepOnExit(SCB_LOW_POWER_ENABLE) for interrupt-only execution: the core then goes back to
+ * sleep straight from the last handler without unstacking to thread mode.
+ */
+void MCAL_SCB_IdleLoop(void);
+/**
+ * @brief Sets or clears SLEEPONEXIT.
+ *
+ * When set, returning from the last active handler to thread mode puts the core to sleep instead; main only runs again
+ * after a handler clears the bit. Saves the unstack/restack of every interrupt in interrupt-driven applications.
+ *
+ * @param[in] Copy_State SCB_LOW_POWER_ENABLE or SCB_LOW_POWER_DISABLE.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_SCB_SetSleepOnExit(u8 Copy_State);
+/**
+ * @brief Sets or clears SEVONPEND (any interrupt becoming pending, enabled or not, wakes WFE).
+ *
+ * @param[in] Copy_State SCB_LOW_POWER_ENABLE or SCB_LOW_POWER_DISABLE.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (also when clearing it while
+ *         SCB_IDLE_MODE is enabled, as the driver waits rely on it).
+ */
+Std_ReturnType MCAL_SCB_SetSevOnPend(u8 Copy_State);
+/*****************************< DWT cycle counter *****************************/
+/**
+ * @brief DWT cycle counter registers.
+ *
+ * The one definition for every driver that times or timestamps with the cycle counter (interrupt statistics, EXTI
+ * timestamps, encoder velocity, idle accounting, cycle delays). CYCCNT counts core cycles and wraps every 2^32.
+ */
+#define SCB_DEMCR                    (*((volatile u32 *)(0xE000EDFC)))
+#define SCB_DWT_CTRL                 (*((volatile u32 *)(0xE0001000)))
+#define SCB_DWT_CYCCNT               (*((volatile u32 *)(0xE0001004)))
+#define SCB_DEMCR_TRCENA_POS         24
+#define SCB_DWT_CTRL_CYCCNTENA_POS   0
+/**
+ * @brief Starts the DWT cycle counter (trace enable, then CYCCNTENA). Calling it again keeps the count running.
+ *
+ * @return Std_ReturnType E_OK.
+ */
+Std_ReturnType MCAL_SCB_StartCycleCounter(void);
+/*****************************< Cycle delays *****************************/
+/**
+ * @brief Core clock cycles per microsecond, the conversion used by MCAL_SCB_DelayUs / MCAL_SCB_DelayNs.
+ *
+ * SYSTEM_CLOCK_FREQUENCY comes from STM32F103C8.h, which the caller of the macros must include.
+ */
+#define SCB_CYCLES_PER_US       (SYSTEM_CLOCK_FREQUENCY / 1000000UL)
+/**
+ * @brief Busy-waits Copy_Us microseconds (u32, up to 2^32 / SCB_CYCLES_PER_US).
+ *
+ * A constant argument folds to a constant cycle count at compile time; otherwise it costs one multiply.
+ */
+#define MCAL_SCB_DelayUs(US)    MCAL_SCB_DelayCycles( (u32)(US) * SCB_CYCLES_PER_US )
+/**
+ * @brief Busy-waits at least Copy_Ns nanoseconds (u32, up to 2^32 / SCB_CYCLES_PER_US), rounded up to whole cycles.
+ *
+ * A constant argument folds to a constant cycle count at compile time; otherwise it costs a multiply and a divide.
+ */
+#define MCAL_SCB_DelayNs(NS)    MCAL_SCB_DelayCycles( ( ((u32)(NS) * SCB_CYCLES_PER_US) + 999UL ) / 1000UL )
+/**
+ * @brief Starts the DWT cycle counter and measures the overhead of MCAL_SCB_DelayCycles.
+ *
+ * The measurement runs with interrupts masked for about SCB_DELAY_CALIBRATION_CYCLES cycles. Until it has run, the
+ * SCB_DELAY_OVERHEAD_CYCLES estimate is used.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_SCB_InitDelay(void);
+/**
+ * @brief Busy-waits Copy_Cycles core cycles on the DWT cycle counter.
+ *
+ * All integer, no SysTick: the call itself is part of the delay (the measured overhead is subtracted), so the time from
+ * the call to the return is Copy_Cycles within a few cycles, interrupts aside. Counts shorter than the overhead return
+ * at once. Interrupt handlers running meanwhile lengthen the delay, never shorten it.
+ *
+ * @param[in] Copy_Cycles Cycles to wait, up to 2^32 - 1 (about two minutes at 36 MHz).
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK if the cycle counter is not running
+ *         (MCAL_SCB_InitDelay not called).
+ */
+Std_ReturnType MCAL_SCB_DelayCycles(u32 Copy_Cycles);
+/**
+ * @brief Reads the idle accounting window and starts a new one.
+ *
+ * CPU load over the window is 1 - Idle / Elapsed. Both counts are core cycles and wrap after 2^32 cycles (about two
+ * minutes at 36 MHz), so read it more often than that, e.g. once a second. Sleep entered through SLEEPONEXIT happens
+ * outside these functions and is not counted.
+ *
+ * @param[out] Copy_IdleCycles Receives the cycles spent asleep in the idle functions during the window.
+ * @param[out] Copy_ElapsedCycles Receives the length of the window.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (NULL pointer, SCB_IDLE_MODE disabled).
+ */
+Std_ReturnType MCAL_SCB_GetIdleStats(u32 *Copy_IdleCycles , u32 *Copy_ElapsedCycles);
+/*****************************< Reset service *****************************/
+/**
+ * @brief Decodes the reset cause and validates the no-init block; call it first in main, before the clock set-up.
+ *
+ * The block is kept when its magic number and CRC-32 match and the reset was not a power-on; otherwise it is cleared
+ * (cold start). The RCC reset flags are cleared afterwards so the next reset reports only its own cause.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (SCB_RESET_SERVICE disabled).
+ */
+Std_ReturnType MCAL_SCB_InitResetService(void);
+/**
+ * @brief Resets the MCU through SYSRESETREQ after recording Copy_Reason in the no-init block. Does not return.
+ *
+ * @param[in] Copy_Reason Application code, reported by MCAL_SCB_GetResetInfo after the reset (1..255).
+ */
+void MCAL_SCB_SoftwareReset(u8 Copy_Reason);
+/**
+ * @brief Reports the reset cause found by MCAL_SCB_InitResetService.
+ *
+ * @param[out] Copy_Info Receives cause, software reason, warm/cold and the warm reset count.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (NULL pointer, service disabled or
+ *         not initialized).
+ */
+Std_ReturnType MCAL_SCB_GetResetInfo(SCB_ResetInfo_t *Copy_Info);
+/**
+ * @brief Reads the warm flags; all clear after a cold start.
+ *
+ * @param[out] Copy_Flags Receives the SCB_WARM_x flags. Left untouched on E_NOT_OK, so a caller that zeroes it first
+ *                        takes the cold path when the service is disabled.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_SCB_GetWarmFlags(u32 *Copy_Flags);
+/**
+ * @brief Sets warm flags, once the state they stand for is valid.
+ *
+ * @param[in] Copy_Flags SCB_WARM_x flags to set.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (service disabled or not initialized).
+ */
+Std_ReturnType MCAL_SCB_SetWarmFlags(u32 Copy_Flags);
+/**
+ * @brief Clears warm flags, e.g. before changing the state they stand for.
+ *
+ * @param[in] Copy_Flags SCB_WARM_x flags to clear.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise (service disabled or not initialized).
+ */
+Std_ReturnType MCAL_SCB_ClearWarmFlags(u32 Copy_Flags);
+/**
+ * @brief Stores an application word (calibration data ...) in the no-init block.
+ *
+ * @param[in] Copy_Index Word index, 0..SCB_NOINIT_USER_WORDS-1.
+ * @param[in] Copy_Value Value to keep.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_SCB_WriteNoInit(u8 Copy_Index , u32 Copy_Value);
+/**
+ * @brief Reads an application word of the no-init block (0 after a cold start).
+ *
+ * @param[in] Copy_Index Word index, 0..SCB_NOINIT_USER_WORDS-1.
+ * @param[out] Copy_Value Receives the word.
+ *
+ * @return Std_ReturnType E_OK if the operation is successful, E_NOT_OK otherwise.
+ */
+Std_ReturnType MCAL_SCB_ReadNoInit(u8 Copy_Index , u32 *Copy_Value);
 #endif /* SCB_INTERFACE_H_ */
\ No newline at end of file
@@ -14,6 +14,34 @@
  */
 #ifndef EXTI_CONFIG_H_
 #define EXTI_CONFIG_H_
+/**
+ * @brief Edge timestamp rings.
+ *
+ * EXTI_TIMESTAMP_MODE:
+ * - EXTI_TIMESTAMP_DISABLED: no rings, no DWT access in the handlers.
+ * - EXTI_TIMESTAMP_ENABLED: lines enabled with MCAL_EXTI_EnableTimestamp record {cycle count, polarity} on every edge.
+ *
+ * EXTI_TIMESTAMP_RING_SIZE: events kept per line, a power of two in 2..128 (8 bytes each, 16 rings).
+ */
+#define EXTI_TIMESTAMP_MODE         EXTI_TIMESTAMP_DISABLED
+#define EXTI_TIMESTAMP_RING_SIZE    8
+/**
+ * @brief Interrupt storm limiter.
+ *
+ * EXTI_STORM_MODE:
+ * - EXTI_STORM_DISABLED: lines are never throttled.
+ * - EXTI_STORM_ENABLED: a line raising more than EXTI_STORM_MAX_EVENTS interrupts within one window is masked in IMR
+ *   for EXTI_STORM_COOLDOWN_TICKS, then unmasked again. MCAL_EXTI_StormTick must be called from a periodic timer
+ *   (e.g. a 1 ms SysTick or GPT callback); windows and cooldowns are counted in calls of it.
+ *
+ * EXTI_STORM_MAX_EVENTS: interrupts allowed per line and window (1..65534).
+ * EXTI_STORM_WINDOW_TICKS: window length in ticks (1..255).
+ * EXTI_STORM_COOLDOWN_TICKS: how long a stormy line stays masked, in ticks (1..65535).
+ */
+#define EXTI_STORM_MODE             EXTI_STORM_DISABLED
+#define EXTI_STORM_MAX_EVENTS       50
+#define EXTI_STORM_WINDOW_TICKS     10
+#define EXTI_STORM_COOLDOWN_TICKS   100
 /**
  * @brief EXTI Configuration Array
  *
@@ -22,10 +50,19 @@
  *
  * To configure an EXTI line, set the appropriate options for LineEnabled and TriggerType.
  *
+ * The table is const, so it stays in flash, and static, so it never clashes with another definition at link time.
+ * Only EXTI_program.c includes this file. MCAL_EXTI_Init folds it into the final IMR, EMR, RTSR, FTSR and AFIO EXTICR
+ * images and writes each register once; lines that are not enabled are left untriggered and masked, and only the
+ * EXTICR fields of enabled lines with a port are written (the others keep their current mapping).
+ *
  * Available options for LineEnabled:
  * - EXTI_LINE_ENABLED: Enable the EXTI line.
  * - EXTI_LINE_DISABLED: Disable the EXTI line.
  *
+ * Available options for EventEnabled (wake-up event to the core, EMR; omitted means disabled):
+ * - EXTI_EVENT_ENABLED: Enable the event of the EXTI line.
+ * - EXTI_EVENT_DISABLED: Disable the event of the EXTI line.
+ *
  * Available options for TriggerType:
  * - EXTI_RISING_EDGE: Configure for a rising edge trigger.
  * - EXTI_FALLING_EDGE: Configure for a falling edge trigger.
@@ -42,14 +79,15 @@
  * - [Callback Function Name]: Specify the name of the callback function to be called
  *   when the EXTI line triggers. If NULL is selected, no function will be called.
  */
-EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
+static const EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
 {
  /**< Configuration for EXTI Line 0 */
     {
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
 
     /* Configuration for EXTI Line 1 */
@@ -57,7 +95,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
 
     /* Configuration for EXTI Line 2 */
@@ -65,7 +104,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 3 */
@@ -73,7 +113,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 4 */
@@ -81,7 +122,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 5 */
@@ -89,7 +131,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 6 */
@@ -97,7 +140,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 7 */
@@ -105,7 +149,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 8 */
@@ -113,7 +158,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 9 */
@@ -121,7 +167,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 10 */
@@ -129,7 +176,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 11 */
@@ -137,7 +185,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 12 */
@@ -145,7 +194,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 13 */
@@ -153,7 +203,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 14 */
@@ -161,7 +212,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     },
     
     /* Configuration for EXTI Line 15 */
@@ -169,7 +221,8 @@ EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT] =
         .SetCallback  = NULL,
         .GPIO_PortMap = EXTI_GPIO_NONE,
         .TriggerType  = EXTI_BOTH_EDGE,
-        .LineEnabled  = EXTI_LINE_DISABLED
+        .LineEnabled  = EXTI_LINE_DISABLED,
+        .EventEnabled = EXTI_EVENT_DISABLED
     }
 };
 
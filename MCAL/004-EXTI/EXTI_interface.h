@@ -49,6 +49,31 @@
  * configuration to execute it when the corresponding EXTI event occurs.
  */
 typedef void (*EXTI_CallbackFunc_t)(void);
+/**
+ * @name EXTI Callback Context
+ * @{
+ */
+#define EXTI_CALLBACK_IMMEDIATE 0   /**< Callback runs inside the EXTI handler (default)                      */
+#define EXTI_CALLBACK_DEFERRED  1   /**< Callback is queued to PendSV (MCAL_SCB_PostDeferredCallback)         */
+/** @} */
+/**
+ * @name EXTI Edge Polarity
+ * @{
+ */
+#define EXTI_POLARITY_FALLING   0
+#define EXTI_POLARITY_RISING    1
+/** @} */
+/**
+ * @brief One timestamped edge.
+ *
+ * Timestamp is the DWT cycle counter (SYSTEM_CLOCK_FREQUENCY ticks per second, wraps every 2^32 cycles) latched at entry
+ * of the EXTI handler; differences between two events are exact modulo 2^32.
+ */
+typedef struct
+{
+    u32 Timestamp;  /**< DWT->CYCCNT at handler entry                 */
+    u8 Polarity;    /**< EXTI_POLARITY_RISING / EXTI_POLARITY_FALLING  */
+}EXTI_Timestamp_t;
 /**
  * @name EXTI Line Numbers
  * @{
@@ -205,6 +230,108 @@ Std_ReturnType MCAL_EXTI_DisablEvent(u8 Copy_Line);
   * @endcode
   */
 Std_ReturnType MCAL_EXTI_SetCallback(u8 Copy_Line , EXTI_CallbackFunc_t CallbackFunc);
+/**
+ * @brief Selects where the callback of a line runs.
+ *
+ * A deferred callback is queued to the PendSV work queue, so the EXTI handler only clears the flag and posts; the
+ * callback then runs at the lowest priority, after every pending handler. If the queue is full or disabled
+ * (SCB_DEFERRED_MODE), the callback runs immediately as a fallback.
+ *
+ * @note A deferred callback runs an unknown time after the edge. Callbacks that read the time of the edge when they
+ * run, such as the ultrasonic echo callback, must stay immediate; use MCAL_EXTI_EnableTimestamp to get edge times
+ * taken in the handler.
+ *
+ * @param[in] Copy_Line EXTI line number (EXTI_LINE0 to EXTI_LINE15).
+ * @param[in] Copy_Mode EXTI_CALLBACK_IMMEDIATE or EXTI_CALLBACK_DEFERRED.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK: Mode set.
+ * @retval E_NOT_OK: Invalid line or mode.
+ */
+Std_ReturnType MCAL_EXTI_SetCallbackMode(u8 Copy_Line , u8 Copy_Mode);
+/**
+ * @brief Starts recording a timestamp for every edge of a line.
+ *
+ * Starts the DWT cycle counter if needed. From then on the line handler latches the cycle counter on entry and
+ * pushes {timestamp, polarity} into the line's single-producer/single-consumer ring, before the callback (if any) runs.
+ * When the line triggers on one edge only, that edge is the polarity; on both edges the pin level read in the handler
+ * is used, so a pulse shorter than the interrupt latency can report the wrong polarity.
+ *
+ * @param[in] Copy_Line EXTI line number (EXTI_LINE0 to EXTI_LINE15).
+ * @param[in] Copy_PortID The GPIO port mapped to the line (GPIO_PORTA, GPIO_PORTB or GPIO_PORTC), used to read the pin level.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK: Timestamping enabled.
+ * @retval E_NOT_OK: Invalid line or port, or EXTI_TIMESTAMP_MODE is EXTI_TIMESTAMP_DISABLED in EXTI_config.h.
+ */
+Std_ReturnType MCAL_EXTI_EnableTimestamp(u8 Copy_Line , u8 Copy_PortID);
+/**
+ * @brief Stops recording timestamps for a line. Events already in the ring can still be read.
+ *
+ * @param[in] Copy_Line EXTI line number (EXTI_LINE0 to EXTI_LINE15).
+ *
+ * @return Std_ReturnType
+ * @retval E_OK: Timestamping disabled.
+ * @retval E_NOT_OK: Invalid line, or timestamp mode disabled.
+ */
+Std_ReturnType MCAL_EXTI_DisableTimestamp(u8 Copy_Line);
+/**
+ * @brief Drains up to Copy_MaxEvents timestamped edges of a line, oldest first.
+ *
+ * Call it from thread context; it is the only consumer of the ring, the line handler is the only producer, so no
+ * interrupt masking is needed. Events that arrived while the ring was full are dropped and counted.
+ *
+ * @param[in] Copy_Line EXTI line number (EXTI_LINE0 to EXTI_LINE15).
+ * @param[out] Copy_Events Receives the events.
+ * @param[in] Copy_MaxEvents Capacity of Copy_Events.
+ * @param[out] Copy_EventsCount Receives the number of events copied.
+ * @param[out] Copy_DroppedCount Receives the number of events dropped since the previous call (may be NULL).
+ *
+ * @return Std_ReturnType
+ * @retval E_OK: Events read (possibly none).
+ * @retval E_NOT_OK: Invalid arguments, or timestamp mode disabled.
+ *
+ * Example:
+ * @code
+ * EXTI_Timestamp_t Edges[8];
+ * u8 Count;
+ * MCAL_EXTI_ReadTimestamps(EXTI_LINE12, Edges, 8, &Count, NULL);
+ * for (u8 i = 1; i < Count; i++) { u32 Cycles = Edges[i].Timestamp - Edges[i - 1].Timestamp; ... }
+ * @endcode
+ */
+Std_ReturnType MCAL_EXTI_ReadTimestamps(u8 Copy_Line , EXTI_Timestamp_t *Copy_Events , u8 Copy_MaxEvents , u8 *Copy_EventsCount , u8 *Copy_DroppedCount);
+/**
+ * @brief Time base of the storm limiter; call it from a periodic timer callback.
+ *
+ * Every EXTI_STORM_WINDOW_TICKS calls the per-line event counters restart. A throttled line is unmasked once its
+ * cooldown has elapsed, after its stale pending flag is cleared.
+ *
+ * @return Std_ReturnType
+ * @retval E_OK: Tick processed.
+ * @retval E_NOT_OK: EXTI_STORM_MODE is EXTI_STORM_DISABLED in EXTI_config.h.
+ *
+ * Example:
+ * @code
+ * void App_EXTIStormTick(void)
+ * {
+ *     MCAL_EXTI_StormTick();
+ * }
+ * MCAL_SYSTICK_SetIntervalPeriodic(1000, App_EXTIStormTick);     /// 1 ms tick
+ * @endcode
+ */
+Std_ReturnType MCAL_EXTI_StormTick(void);
+/**
+ * @brief Reports how often a line has been throttled and whether it is masked right now.
+ *
+ * @param[in] Copy_Line EXTI line number (EXTI_LINE0 to EXTI_LINE15).
+ * @param[out] Copy_StormCount Receives the number of storms detected on the line since start-up (saturates at 65535).
+ * @param[out] Copy_IsThrottled Receives 1 while the line is masked by the limiter, 0 otherwise (may be NULL).
+ *
+ * @return Std_ReturnType
+ * @retval E_OK: Counters read.
+ * @retval E_NOT_OK: Invalid arguments, or storm mode disabled.
+ */
+Std_ReturnType MCAL_EXTI_GetStormStatus(u8 Copy_Line , u16 *Copy_StormCount , u8 *Copy_IsThrottled);
 /** @} */ // End of EXTI_Control
 
 #endif /* EXTI_INTERFACE_H_ */
\ No newline at end of file
@@ -47,10 +47,36 @@ typedef struct
 
 /**< Total number of EXTI lines available */
 #define EXTI_LINES_COUNT    16
+/**< Lines sharing the EXTI9_5 and EXTI15_10 vectors */
+#define EXTI_LINES_9_5_MASK     0x000003E0
+#define EXTI_LINES_15_10_MASK   0x0000FC00
+/**< Index of the lowest set bit (X != 0); GCC emits RBIT + CLZ on the Cortex-M3 */
+#define EXTI_CTZ(X)             ( (u8)__builtin_ctz(X) )
+/*******************************< Timestamp source (DWT cycle counter, SCB_interface.h) *******************************/
+#define EXTI_TIMESTAMP_DISABLED 0
+#define EXTI_TIMESTAMP_ENABLED  1
+
+/**< Keeps the compiler from moving the event store after the index store that publishes it */
+#define EXTI_COMPILER_BARRIER() __asm volatile ("" : : : "memory")
+/*******************************< Storm limiter *******************************/
+#define EXTI_STORM_DISABLED     0
+#define EXTI_STORM_ENABLED      1
+/**
+ * Bit-band alias of one IMR bit. The limiter masks a line from the EXTI handler and unmasks it from the tick, which may
+ * run at another priority; single-bit alias stores cannot lose a concurrent update of another line the way a
+ * read-modify-write of IMR could.
+ */
+#define EXTI_IMR_BITBAND(LINE)  (*((volatile u32 *)(0x42000000 + ((EXTI_BASE_ADDRESS - 0x40000000) * 32) + ((LINE) * 4))))
 /**< EXTI line enabled */
 #define EXTI_LINE_ENABLED       1
 /**< EXTI line disabled */
 #define EXTI_LINE_DISABLED      0
+/**< EXTI event (EMR) enabled */
+#define EXTI_EVENT_ENABLED      1
+/**< EXTI event (EMR) disabled */
+#define EXTI_EVENT_DISABLED     0
+/**< Lines 0..15 in IMR/EMR/RTSR/FTSR; the bits above belong to PVD, RTC alarm and USB wakeup and are preserved */
+#define EXTI_GPIO_LINES_MASK    0x0000FFFF
 /**
  * @name EXTI Port Mapping
  * @{
@@ -68,11 +94,9 @@ typedef struct
     u8 GPIO_PortMap: 3;
     u8 TriggerType: 2;
     u8 LineEnabled:1;
-    u8 : 2;
+    u8 EventEnabled:1;
+    u8 : 1;
 }EXTI_Configration_t;
 
-/**< EXTI line configuration settings */
-extern EXTI_Configration_t Exti_Configrations[EXTI_LINES_COUNT];
-
 
 #endif /* EXTI_PRIVATE_H_ */
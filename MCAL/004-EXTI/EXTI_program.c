@@ -20,30 +20,124 @@
 #include "GPIO_interface.h"
 /**< AFIO */
 #include "AFIO_interface.h"
+/**< NVIC */
+#include "NVIC_stats.h"
+/**< SCB */
+#include "SCB_interface.h"
 /**< GPIO */
 #include "EXTI_interface.h"
 #include "EXTI_private.h"
 #include "EXTI_config.h"
 /**************************************** Global Variables Section *****************************************************/
 static EXTI_CallbackFunc_t EXTI_Callback[16] = {NULL};
+/* Bit n set: the callback of line n is posted to the PendSV work queue instead of being called from the handler */
+static u16 EXTI_DeferredLines = 0;
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+#if ( (EXTI_TIMESTAMP_RING_SIZE < 2) || (EXTI_TIMESTAMP_RING_SIZE > 128) || ( (EXTI_TIMESTAMP_RING_SIZE & (EXTI_TIMESTAMP_RING_SIZE - 1)) != 0 ) )
+    #error "EXTI_TIMESTAMP_RING_SIZE must be a power of two in 2..128"
+#endif
+/**
+ * Single-producer/single-consumer ring of one line. Head is written only by the line handler and Tail only by
+ * MCAL_EXTI_ReadTimestamps; both run freely modulo 256, so Head - Tail is the fill level. Dropped is also
+ * producer-only, the consumer keeps the last value it reported in DroppedSeen.
+ */
+typedef struct
+{
+    EXTI_Timestamp_t Events[EXTI_TIMESTAMP_RING_SIZE];
+    volatile u8 Head;
+    volatile u8 Tail;
+    volatile u8 Dropped;
+    u8 DroppedSeen;
+}EXTI_TimestampRing_t;
+static EXTI_TimestampRing_t EXTI_TimestampRing[EXTI_LINES_COUNT];
+/* IDR of the port mapped to each line; NULL while timestamping is off for the line */
+static volatile u32 *EXTI_TimestampIDR[EXTI_LINES_COUNT] = {NULL};
+#elif EXTI_TIMESTAMP_MODE != EXTI_TIMESTAMP_DISABLED
+    #error "Wrong EXTI_TIMESTAMP_MODE configuration"
+#endif
+#if EXTI_STORM_MODE == EXTI_STORM_ENABLED
+#if ( (EXTI_STORM_MAX_EVENTS < 1) || (EXTI_STORM_MAX_EVENTS > 65534) )
+    #error "EXTI_STORM_MAX_EVENTS must be in 1..65534"
+#endif
+#if ( (EXTI_STORM_WINDOW_TICKS < 1) || (EXTI_STORM_WINDOW_TICKS > 255) )
+    #error "EXTI_STORM_WINDOW_TICKS must be in 1..255"
+#endif
+#if ( (EXTI_STORM_COOLDOWN_TICKS < 1) || (EXTI_STORM_COOLDOWN_TICKS > 65535) )
+    #error "EXTI_STORM_COOLDOWN_TICKS must be in 1..65535"
+#endif
+/* Interrupts of each line in the current window; restarted by MCAL_EXTI_StormTick */
+static volatile u16 EXTI_StormEvents[EXTI_LINES_COUNT] = {0};
+/* Remaining cooldown ticks of each line; non-zero only while the limiter holds the line masked */
+static volatile u16 EXTI_StormCooldown[EXTI_LINES_COUNT] = {0};
+static volatile u16 EXTI_StormCount[EXTI_LINES_COUNT] = {0};
+static u8 EXTI_StormWindowTicks = 0;
+#elif EXTI_STORM_MODE != EXTI_STORM_DISABLED
+    #error "Wrong EXTI_STORM_MODE configuration"
+#endif
+/**************************************** Static Functions Section *****************************************************/
+static void EXTI_voidDispatch(u32 Copy_LinesMask);
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+static void EXTI_voidPushTimestamp(u8 Copy_Line , u32 Copy_Timestamp);
+#endif
 /*====================================================   Start_FUNCTION   ====================================================*/
 Std_ReturnType MCAL_EXTI_Init(void)
 {
     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
-    for (u8 line = 0; line < EXTI_LINES_COUNT; line++)
-    {
-        if( Exti_Configrations[line].LineEnabled == EXTI_LINE_ENABLED)
-        {
-            MCAL_EXTI_EnableLine(line);
-            MCAL_EXTI_SetTrigger(line,Exti_Configrations[line].TriggerType);
-            MCAL_EXTI_SetCallback(line , Exti_Configrations[line].SetCallback);
-            MCAL_AFIO_SetEXTIConfigration(line , Exti_Configrations[line].GPIO_PortMap);
-            Local_FunctionStatus = E_OK;
-        }else
+    u32 Local_IMR = 0, Local_EMR = 0, Local_RTSR = 0, Local_FTSR = 0;
+    u32 Local_EXTICR[4] = {0};
+    u32 Local_OldIMR;
+    u16 Local_MappedLines = 0;
+    u8 Local_Line;
+    /* Fold the table into register images, then commit each register with one store */
+    for (Local_Line = 0; Local_Line < EXTI_LINES_COUNT; Local_Line++)
+    {
+        if (Exti_Configrations[Local_Line].LineEnabled == EXTI_LINE_ENABLED)
         {
-            MCAL_EXTI_DisableLine(line);
-            Local_FunctionStatus = E_OK;
+            SET_BIT(Local_IMR , Local_Line);
+            if (Exti_Configrations[Local_Line].EventEnabled == EXTI_EVENT_ENABLED)
+            {
+                SET_BIT(Local_EMR , Local_Line);
+            }
+            if (Exti_Configrations[Local_Line].TriggerType != EXTI_FALLING_EDGE)
+            {
+                SET_BIT(Local_RTSR , Local_Line);
+            }
+            if (Exti_Configrations[Local_Line].TriggerType != EXTI_RISING_EDGE)
+            {
+                SET_BIT(Local_FTSR , Local_Line);
+            }
+            if (Exti_Configrations[Local_Line].GPIO_PortMap <= EXTI_PORTMAP_GPIOC)
+            {
+                Local_EXTICR[Local_Line / 4] |= ( (u32)Exti_Configrations[Local_Line].GPIO_PortMap << ( (Local_Line % 4) * 4 ) );
+                SET_BIT(Local_MappedLines , Local_Line);
+            }
+            if (Exti_Configrations[Local_Line].SetCallback != NULL)
+            {
+                EXTI_Callback[Local_Line] = Exti_Configrations[Local_Line].SetCallback;
+            }
         }
+#if EXTI_STORM_MODE == EXTI_STORM_ENABLED
+        EXTI_StormCooldown[Local_Line] = 0;
+        EXTI_StormEvents[Local_Line] = 0;
+#endif
+    }
+    /* Mask everything first so no line fires while its trigger and port mapping are half written */
+    Local_OldIMR = EXTI->IMR;
+    EXTI->IMR = Local_OldIMR & ~EXTI_GPIO_LINES_MASK;
+    EXTI->EMR = ( EXTI->EMR & ~EXTI_GPIO_LINES_MASK ) | Local_EMR;
+    EXTI->RTSR = ( EXTI->RTSR & ~EXTI_GPIO_LINES_MASK ) | Local_RTSR;
+    EXTI->FTSR = ( EXTI->FTSR & ~EXTI_GPIO_LINES_MASK ) | Local_FTSR;
+    /* Lines without a port in the table keep the mapping they already have */
+    Local_FunctionStatus = MCAL_AFIO_SetEXTIConfigAll(Local_EXTICR , Local_MappedLines);
+    if (Local_FunctionStatus == E_OK)
+    {
+        /* Drop edges latched before the configuration was complete */
+        EXTI->PR = Local_IMR;
+        EXTI->IMR = EXTI->IMR | Local_IMR;
+    }else
+    {
+        /* The mapping was not written: unmask what was live before rather than lines on a stale port */
+        EXTI->IMR = Local_OldIMR;
     }
     return Local_FunctionStatus;
 }
@@ -55,7 +149,12 @@ Std_ReturnType MCAL_EXTI_EnableLine(u8 Copy_Line)
     if (Copy_Line < EXTI_LINES_COUNT)
     {
         
-        SET_BIT( EXTI->IMR , Copy_Line );
+#if EXTI_STORM_MODE == EXTI_STORM_ENABLED
+        EXTI_StormCooldown[Copy_Line] = 0;
+        EXTI_StormEvents[Copy_Line] = 0;
+#endif
+        /* Bit-band store: a read-modify-write of IMR could undo a storm mask set by the ISR in between */
+        EXTI_IMR_BITBAND(Copy_Line) = 1;
         Local_FunctionStatus = E_OK;
     }else
     {
@@ -71,7 +170,11 @@ Std_ReturnType MCAL_EXTI_DisableLine(u8 Copy_Line)
     if (Copy_Line < EXTI_LINES_COUNT)
     {
         
-        CLR_BIT( EXTI->IMR , Copy_Line );
+        EXTI_IMR_BITBAND(Copy_Line) = 0;
+#if EXTI_STORM_MODE == EXTI_STORM_ENABLED
+        /* A line disabled by the application must not be unmasked again when its cooldown ends */
+        EXTI_StormCooldown[Copy_Line] = 0;
+#endif
         Local_FunctionStatus = E_OK;
     }else
     {
@@ -121,7 +224,8 @@ Std_ReturnType MCAL_EXTI_ClearPending(u8 Copy_Line)
     if (Copy_Line < EXTI_LINES_COUNT)
     {
         
-        SET_BIT( EXTI->PR , Copy_Line );
+        /* PR is write-1-to-clear: a read-modify-write would also clear the other pending lines */
+        EXTI->PR = ( (u32)1 << Copy_Line );
         Local_FunctionStatus = E_OK;
     }else
     {
@@ -192,146 +296,314 @@ Std_ReturnType MCAL_EXTI_SetCallback(u8 Copy_Line , EXTI_CallbackFunc_t Callback
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI0_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_SetCallbackMode(u8 Copy_Line , u8 Copy_Mode)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Line < EXTI_LINES_COUNT) && (Copy_Mode == EXTI_CALLBACK_IMMEDIATE) )
     {
-        EXTI_Callback[EXTI_LINE0]();
+        CLR_BIT( EXTI_DeferredLines , Copy_Line );
+        Local_FunctionStatus = E_OK;
+    }else if ( (Copy_Line < EXTI_LINES_COUNT) && (Copy_Mode == EXTI_CALLBACK_DEFERRED) )
+    {
+        SET_BIT( EXTI_DeferredLines , Copy_Line );
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
     }
+    return Local_FunctionStatus;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI1_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_EnableTimestamp(u8 Copy_Line , u8 Copy_PortID)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+    u32 Local_IDRAddress = 0;
+    if ( (Copy_Line < EXTI_LINES_COUNT) && (MCAL_GPIO_GetPortRegAddress(Copy_PortID , GPIO_REG_IDR , &Local_IDRAddress) == E_OK) )
+    {
+        MCAL_SCB_StartCycleCounter();
+        /* The handler does not touch the ring until the IDR pointer is published */
+        EXTI_TimestampRing[Copy_Line].Head = 0;
+        EXTI_TimestampRing[Copy_Line].Tail = 0;
+        EXTI_TimestampRing[Copy_Line].Dropped = 0;
+        EXTI_TimestampRing[Copy_Line].DroppedSeen = 0;
+        EXTI_COMPILER_BARRIER();
+        EXTI_TimestampIDR[Copy_Line] = (volatile u32 *)Local_IDRAddress;
+        Local_FunctionStatus = E_OK;
+    }else
     {
-        EXTI_Callback[EXTI_LINE1]();
+        Local_FunctionStatus = E_NOT_OK;
     }
+#else
+    (void)Copy_Line;
+    (void)Copy_PortID;
+#endif
+    return Local_FunctionStatus;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI2_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_DisableTimestamp(u8 Copy_Line)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+    if (Copy_Line < EXTI_LINES_COUNT)
+    {
+        EXTI_TimestampIDR[Copy_Line] = NULL;
+        Local_FunctionStatus = E_OK;
+    }else
     {
-        EXTI_Callback[EXTI_LINE2]();
+        Local_FunctionStatus = E_NOT_OK;
     }
+#else
+    (void)Copy_Line;
+#endif
+    return Local_FunctionStatus;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI3_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_ReadTimestamps(u8 Copy_Line , EXTI_Timestamp_t *Copy_Events , u8 Copy_MaxEvents , u8 *Copy_EventsCount , u8 *Copy_DroppedCount)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+    EXTI_TimestampRing_t *Local_Ring;
+    u8 Local_Tail, Local_Head, Local_Dropped;
+    u8 Local_Count = 0;
+    if ( (Copy_Line < EXTI_LINES_COUNT) && (Copy_Events != NULL) && (Copy_EventsCount != NULL) )
+    {
+        Local_Ring = &EXTI_TimestampRing[Copy_Line];
+        Local_Tail = Local_Ring->Tail;
+        Local_Head = Local_Ring->Head;
+        while ( (Local_Tail != Local_Head) && (Local_Count < Copy_MaxEvents) )
+        {
+            Copy_Events[Local_Count] = Local_Ring->Events[Local_Tail & (EXTI_TIMESTAMP_RING_SIZE - 1)];
+            Local_Count++;
+            Local_Tail++;
+        }
+        /* Hand the slots back only after they have been copied */
+        EXTI_COMPILER_BARRIER();
+        Local_Ring->Tail = Local_Tail;
+        *Copy_EventsCount = Local_Count;
+        if (Copy_DroppedCount != NULL)
+        {
+            Local_Dropped = Local_Ring->Dropped;
+            *Copy_DroppedCount = (u8)(Local_Dropped - Local_Ring->DroppedSeen);
+            Local_Ring->DroppedSeen = Local_Dropped;
+        }
+        Local_FunctionStatus = E_OK;
+    }else
     {
-        EXTI_Callback[EXTI_LINE3]();
+        Local_FunctionStatus = E_NOT_OK;
     }
+#else
+    (void)Copy_Line;
+    (void)Copy_Events;
+    (void)Copy_MaxEvents;
+    (void)Copy_EventsCount;
+    (void)Copy_DroppedCount;
+#endif
+    return Local_FunctionStatus;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI4_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_StormTick(void)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if EXTI_STORM_MODE == EXTI_STORM_ENABLED
+    u8 Local_WindowEnd = 0;
+    EXTI_StormWindowTicks++;
+    if (EXTI_StormWindowTicks >= EXTI_STORM_WINDOW_TICKS)
     {
-        EXTI_Callback[EXTI_LINE4]();
+        EXTI_StormWindowTicks = 0;
+        Local_WindowEnd = 1;
     }
-}
-/*====================================================   END_FUNCTION   ====================================================*/
-/*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI5_IRQHandler(void)
-{
-    if (EXTI_Callback != NULL)
+    for (u8 Local_Line = 0; Local_Line < EXTI_LINES_COUNT; Local_Line++)
     {
-        EXTI_Callback[EXTI_LINE5]();
+        if (Local_WindowEnd)
+        {
+            EXTI_StormEvents[Local_Line] = 0;
+        }
+        if (EXTI_StormCooldown[Local_Line] != 0)
+        {
+            EXTI_StormCooldown[Local_Line]--;
+            if (EXTI_StormCooldown[Local_Line] == 0)
+            {
+                /* Drop the edges latched while masked, so the line restarts clean */
+                EXTI->PR = ( (u32)1 << Local_Line );
+                EXTI_StormEvents[Local_Line] = 0;
+                EXTI_IMR_BITBAND(Local_Line) = 1;
+            }
+        }
     }
+    Local_FunctionStatus = E_OK;
+#endif
+    return Local_FunctionStatus;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI6_IRQHandler(void)
+Std_ReturnType MCAL_EXTI_GetStormStatus(u8 Copy_Line , u16 *Copy_StormCount , u8 *Copy_IsThrottled)
 {
-    if (EXTI_Callback != NULL)
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if EXTI_STORM_MODE == EXTI_STORM_ENABLED
+    if ( (Copy_Line < EXTI_LINES_COUNT) && (Copy_StormCount != NULL) )
     {
-        EXTI_Callback[EXTI_LINE6]();
+        *Copy_StormCount = EXTI_StormCount[Copy_Line];
+        if (Copy_IsThrottled != NULL)
+        {
+            *Copy_IsThrottled = (EXTI_StormCooldown[Copy_Line] != 0) ? 1 : 0;
+        }
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
     }
+#else
+    (void)Copy_Line;
+    (void)Copy_StormCount;
+    (void)Copy_IsThrottled;
+#endif
+    return Local_FunctionStatus;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI7_IRQHandler(void)
+/**
+ * @brief Serves every pending, unmasked line of a vector.
+ *
+ * PR is masked with IMR and with the lines of the vector, cleared with one write-1-to-clear store, then the set bits
+ * are walked lowest line first with count-trailing-zeros (RBIT + CLZ on the Cortex-M3). The loop runs once per pending
+ * line, so the latency is bounded by the number of lines that fired, not by the width of the vector. Clearing before
+ * the callbacks run means an edge arriving during a callback pends the line again instead of being lost.
+ */
+static void EXTI_voidDispatch(u32 Copy_LinesMask)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE7]();
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+    /* Latched first so the timestamp only carries the hardware entry latency */
+    u32 Local_Timestamp = SCB_DWT_CYCCNT;
+#endif
+    u32 Local_Pending = EXTI->PR & EXTI->IMR & Copy_LinesMask;
+    u8 Local_Line;
+    EXTI->PR = Local_Pending;
+    while (Local_Pending != 0)
+    {
+        Local_Line = EXTI_CTZ(Local_Pending);
+        Local_Pending &= Local_Pending - 1;
+#if EXTI_STORM_MODE == EXTI_STORM_ENABLED
+        EXTI_StormEvents[Local_Line]++;
+        if (EXTI_StormEvents[Local_Line] > EXTI_STORM_MAX_EVENTS)
+        {
+            /* Storm: mask the line until MCAL_EXTI_StormTick ends its cooldown; this event is still served */
+            EXTI_IMR_BITBAND(Local_Line) = 0;
+            EXTI_StormCooldown[Local_Line] = EXTI_STORM_COOLDOWN_TICKS;
+            EXTI_StormEvents[Local_Line] = 0;
+            if (EXTI_StormCount[Local_Line] != 0xFFFF)
+            {
+                EXTI_StormCount[Local_Line]++;
+            }
+        }
+#endif
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+        if (EXTI_TimestampIDR[Local_Line] != NULL)
+        {
+            EXTI_voidPushTimestamp(Local_Line , Local_Timestamp);
+        }
+#endif
+        if (EXTI_Callback[Local_Line] != NULL)
+        {
+            if ( (GET_BIT(EXTI_DeferredLines , Local_Line) == 0) || (MCAL_SCB_PostDeferredCallback(EXTI_Callback[Local_Line]) != E_OK) )
+            {
+                EXTI_Callback[Local_Line]();
+            }
+        }
     }
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI8_IRQHandler(void)
+#if EXTI_TIMESTAMP_MODE == EXTI_TIMESTAMP_ENABLED
+static void EXTI_voidPushTimestamp(u8 Copy_Line , u32 Copy_Timestamp)
 {
-    if (EXTI_Callback != NULL)
+    EXTI_TimestampRing_t *Local_Ring = &EXTI_TimestampRing[Copy_Line];
+    EXTI_Timestamp_t *Local_Event;
+    u8 Local_Head = Local_Ring->Head;
+    u8 Local_Rising = GET_BIT(EXTI->RTSR , Copy_Line);
+    u8 Local_Falling = GET_BIT(EXTI->FTSR , Copy_Line);
+    if ( (u8)(Local_Head - Local_Ring->Tail) < EXTI_TIMESTAMP_RING_SIZE )
+    {
+        Local_Event = &Local_Ring->Events[Local_Head & (EXTI_TIMESTAMP_RING_SIZE - 1)];
+        Local_Event->Timestamp = Copy_Timestamp;
+        if (Local_Rising && !Local_Falling)
+        {
+            Local_Event->Polarity = EXTI_POLARITY_RISING;
+        }else if (Local_Falling && !Local_Rising)
+        {
+            Local_Event->Polarity = EXTI_POLARITY_FALLING;
+        }else
+        {
+            Local_Event->Polarity = GET_BIT(*EXTI_TimestampIDR[Copy_Line] , Copy_Line) ? EXTI_POLARITY_RISING : EXTI_POLARITY_FALLING;
+        }
+        /* Publish the event only once it is complete */
+        EXTI_COMPILER_BARRIER();
+        Local_Ring->Head = Local_Head + 1;
+    }else
     {
-        EXTI_Callback[EXTI_LINE8]();
+        Local_Ring->Dropped++;
     }
 }
+#endif
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI9_IRQHandler(void)
+void EXTI0_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE9]();
-    }
+    NVIC_STATS_ENTER();
+    EXTI_voidDispatch( (u32)1 << EXTI_LINE0 );
+    NVIC_STATS_EXIT(NVIC_EXTI0_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI10_IRQHandler(void)
+void EXTI1_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE10]();
-    }
+    NVIC_STATS_ENTER();
+    EXTI_voidDispatch( (u32)1 << EXTI_LINE1 );
+    NVIC_STATS_EXIT(NVIC_EXTI1_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI11_IRQHandler(void)
+void EXTI2_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE11]();
-    }
+    NVIC_STATS_ENTER();
+    EXTI_voidDispatch( (u32)1 << EXTI_LINE2 );
+    NVIC_STATS_EXIT(NVIC_EXTI2_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI12_IRQHandler(void)
+void EXTI3_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE12]();
-    }
+    NVIC_STATS_ENTER();
+    EXTI_voidDispatch( (u32)1 << EXTI_LINE3 );
+    NVIC_STATS_EXIT(NVIC_EXTI3_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI13_IRQHandler(void)
+void EXTI4_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE13]();
-    }
+    NVIC_STATS_ENTER();
+    EXTI_voidDispatch( (u32)1 << EXTI_LINE4 );
+    NVIC_STATS_EXIT(NVIC_EXTI4_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI14_IRQHandler(void)
+void EXTI9_5_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE14]();
-    }
+    NVIC_STATS_ENTER();
+    EXTI_voidDispatch(EXTI_LINES_9_5_MASK);
+    NVIC_STATS_EXIT(NVIC_EXTI9_5_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void EXTI15_IRQHandler(void)
+void EXTI15_10_IRQHandler(void)
 {
-    if (EXTI_Callback != NULL)
-    {
-        EXTI_Callback[EXTI_LINE15]();
-    }
+    NVIC_STATS_ENTER();
+    EXTI_voidDispatch(EXTI_LINES_15_10_MASK);
+    NVIC_STATS_EXIT(NVIC_EXTI15_10_IRQn);
 }
-/*====================================================   END_FUNCTION   ====================================================*/
\ No newline at end of file
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   END_ FILE   ====================================================*/
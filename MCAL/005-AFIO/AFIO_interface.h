@@ -134,5 +134,20 @@ Std_ReturnType MCAL_AFIO_SetRemap(AFIO_RemapConfig_t Copy_RemapConfig);
  * @endcode
  */
 Std_ReturnType MCAL_AFIO_SetEXTIConfigration(u8 Copy_Line , u8 Copy_PortMap);
+/**
+ * @brief Writes the port mapping of several EXTI lines, one store per EXTI configuration register.
+ *
+ * Each register holds the port mapping of four lines, one nibble per line (AFIO_GPIOA, AFIO_GPIOB or AFIO_GPIOC),
+ * line 4 * n + k in bits 4k..4k+3 of word n. Only the lines set in Copy_LinesMask are written; the others keep their
+ * mapping. A register with no selected line is not accessed, so a whole mapping built beforehand (e.g. from a
+ * configuration table) costs at most four writes instead of a read-modify-write per line.
+ *
+ * @param[in] Copy_EXTICR The four register images, EXTICR1 first.
+ * @param[in] Copy_LinesMask The lines to map (bit n = line n).
+ *
+ * @return Std_ReturnType E_OK if the configuration is successful, E_NOT_OK otherwise (NULL pointer or a selected
+ *         nibble above AFIO_GPIOC); nothing is written on failure.
+ */
+Std_ReturnType MCAL_AFIO_SetEXTIConfigAll(const u32 Copy_EXTICR[4] , u16 Copy_LinesMask);
 
 #endif /* AFIO_INTERFACE_H_ */
\ No newline at end of file
@@ -41,6 +41,46 @@ Std_ReturnType MCAL_AFIO_SetEXTIConfigration(u8 Copy_Line , u8 Copy_PortMap)
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_AFIO_SetEXTIConfigAll(const u32 Copy_EXTICR[4] , u16 Copy_LinesMask)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u8 Local_Valid = 1;
+    u32 Local_Nibbles[4] = {0};
+    if (Copy_EXTICR == NULL)
+    {
+        return Local_FunctionStatus;
+    }
+    for (u8 Local_Line = 0; Local_Line < 16; Local_Line++)
+    {
+        if (GET_BIT(Copy_LinesMask , Local_Line) == 1)
+        {
+            Local_Nibbles[Local_Line / 4] |= ( (u32)0x0F << ( (Local_Line % 4) * 4 ) );
+        }
+    }
+    for (u8 Local_Reg = 0; Local_Reg < 4; Local_Reg++)
+    {
+        /* Each selected nibble must be a port of this package (0..2); the others are ignored */
+        u32 Local_Image = Copy_EXTICR[Local_Reg] & Local_Nibbles[Local_Reg];
+        if ( (Local_Image & 0xCCCC) != 0 || ( (Local_Image & (Local_Image >> 1) & 0x1111) != 0 ) )
+        {
+            Local_Valid = 0;
+        }
+    }
+    if (Local_Valid)
+    {
+        for (u8 Local_Reg = 0; Local_Reg < 4; Local_Reg++)
+        {
+            if (Local_Nibbles[Local_Reg] != 0)
+            {
+                AFIO->EXTICR[Local_Reg] = ( AFIO->EXTICR[Local_Reg] & ~Local_Nibbles[Local_Reg] ) | ( Copy_EXTICR[Local_Reg] & Local_Nibbles[Local_Reg] );
+            }
+        }
+        Local_FunctionStatus = E_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
 Std_ReturnType MCAL_AFIO_SetRemap(AFIO_RemapConfig_t Copy_RemapConfig)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
@@ -44,5 +44,41 @@
  * @retval None
  */
 #define SYSTICK_TICKINT SYSTICK_TICKINT_ENABLED
+/**
+ * @brief Period of the free-running timebase in microseconds.
+ *
+ * SysTick is reloaded with a fixed value and never stopped by the drivers; SysTick_Handler runs once per period to
+ * extend the 24-bit counter into the 64-bit uptime. The period is also the resolution of the interval callbacks and
+ * how often a long delay wakes from sleep. (Period * ticks per microsecond) must fit the 24-bit reload register.
+ *
+ * @note Requires SYSTICK_TICKINT = SYSTICK_TICKINT_ENABLED.
+ */
+#define SYSTICK_TIMEBASE_PERIOD_US  1000
+/**
+ * @brief Software timers (hierarchical timing wheel).
+ *
+ * SYSTICK_TIMER_MODE:
+ * - SYSTICK_TIMER_DISABLED: the MCAL_SYSTICK_Timer* functions return E_NOT_OK and the handler does no wheel work.
+ * - SYSTICK_TIMER_ENABLED: any number of SYSTICK_Timer_t objects run on the timebase, with a resolution of one
+ *   timebase period. The wheel costs 1 KB of RAM (4 levels of 64 slot pointers).
+ *
+ * Expiries run from PendSV through the SCB deferred work queue (SCB_DEFERRED_MODE enabled); without it they run in
+ * SysTick_Handler, which then must not outrank SCB_CRITICAL_CEILING.
+ */
+#define SYSTICK_TIMER_MODE          SYSTICK_TIMER_DISABLED
+/**
+ * @brief Tickless idle.
+ *
+ * SYSTICK_TICKLESS_MODE:
+ * - SYSTICK_TICKLESS_DISABLED: MCAL_SYSTICK_TicklessIdle returns E_NOT_OK.
+ * - SYSTICK_TICKLESS_ENABLED: MCAL_SYSTICK_TicklessIdle stretches the SysTick reload up to the next software timer or
+ *   interval deadline (chaining reloads past the 24-bit limit) and sleeps in WFI, so an idle core is not woken every
+ *   period.
+ *
+ * SYSTICK_TICKLESS_MIN_PERIODS: idle periods below which the ordinary periodic tick is kept (2 or more); reprogramming
+ * the counter costs a few ticks of uptime accuracy each time, so very short sleeps are not worth it.
+ */
+#define SYSTICK_TICKLESS_MODE           SYSTICK_TICKLESS_DISABLED
+#define SYSTICK_TICKLESS_MIN_PERIODS    2
 
 #endif /* SYSTICK_CONFIG_H_ */
\ No newline at end of file
@@ -15,6 +15,32 @@
 #define SYSTICK_INTERFACE_H_
 
 typedef void(*SYSTICK_CallbackFunc_t)(void);
+/**
+ * @brief Software timer expiry function; Copy_Context is the pointer given to MCAL_SYSTICK_TimerCreate.
+ */
+typedef void (*SYSTICK_TimerFunc_t)(void *Copy_Context);
+/**
+ * @brief Software timer object, allocated by the application (static or global) and linked into the timer wheel.
+ *
+ * The fields belong to the driver; only use them through the MCAL_SYSTICK_Timer* functions. A zero-initialized
+ * object is idle.
+ */
+typedef struct SYSTICK_Timer_s
+{
+    struct SYSTICK_Timer_s *Next;       /**< Next timer in the same wheel slot                          */
+    struct SYSTICK_Timer_s **Link;      /**< Pointer that points at this timer, NULL while idle         */
+    u32 Expiry;                         /**< Wheel tick (timebase period) at which it expires            */
+    u32 Period;                         /**< Reload in periods, 0 for a one-shot timer                   */
+    SYSTICK_TimerFunc_t Func;           /**< Expiry function                                            */
+    void *Context;                      /**< Argument of Func                                           */
+}SYSTICK_Timer_t;
+/**
+ * @name Callback context
+ * @{
+ */
+#define SYSTICK_CALLBACK_IMMEDIATE  0   /**< Callback runs inside SysTick_Handler (default) */
+#define SYSTICK_CALLBACK_DEFERRED   1   /**< Callback is queued to the PendSV work queue    */
+/** @} */
 /**
  * @brief Initializes the SysTick timer with the specified reload value.
  *
@@ -25,12 +51,14 @@ typedef void(*SYSTICK_CallbackFunc_t)(void);
  * @param[in] Copy_Ticks The number of clock cycles to reload the SysTick timer with.
  *
  * @note The actual time duration for the timer to reach zero depends on the clock frequency and the value passed as `Copy_Ticks`.
+ * @note `Copy_Ticks + 1` becomes the period of the free-running timebase in place of SYSTICK_TIMEBASE_PERIOD_US; it can
+ *       only be chosen while the timer is stopped, since the uptime is counted in whole periods.
  * 
  * @warning This function should be used carefully, as improper configuration may lead to unexpected behavior.
  *
  * @return
  *     - E_OK if the reload value was set successfully.
- *     - E_NOT_OK if the reload value is out of range (see STK_RELOAD_MAX for the valid range). */
+ *     - E_NOT_OK if the reload value is out of range (see STK_RELOAD_MAX for the valid range) or the timer is already running. */
 Std_ReturnType MCAL_SYSTICK_xINIT(u32 Copy_Ticks);
 /**
  * @brief Initialize the SysTick Timer
@@ -43,6 +71,9 @@ Std_ReturnType MCAL_SYSTICK_xINIT(u32 Copy_Ticks);
  *
  * @warning This function should be called before using the SysTick timer for any timing-related tasks.
  *
+ * @note The timer is started as a free-running timebase of SYSTICK_TIMEBASE_PERIOD_US. Calling it again while the
+ *       timebase runs does nothing, so every driver that uses SysTick may call it.
+ *
  * @param None.
  *
  * @return
@@ -61,6 +92,8 @@ Std_ReturnType MCAL_SYSTICK_vINIT();
  *
  * @param[in] Copy_ReloadValue The reload value to set (must be within the valid range).
  *
+ * @note Refused while the timer is running: the period of the timebase is fixed once the uptime counts.
+ *
  * @note The actual time duration between interrupts or timer overflows depends on the
  *       system clock frequency and the specified reload value.
  *
@@ -86,6 +119,7 @@ Std_ReturnType MCAL_SYSTICK_Start();
  * @brief Stops the SysTick timer.
  *
  * This function stops the SysTick timer. Once the timer is stopped, it will no longer count down or generate interrupts.
+ * The uptime is paused with it and resumes on MCAL_SYSTICK_Start.
  *
  * @param None.
  *
@@ -96,8 +130,7 @@ Std_ReturnType MCAL_SYSTICK_Stop();
 /**
  * @brief Resets the SysTick timer.
  *
- * This function disables the SysTick timer, clears the current value, sets the reload value to 0,
- * and clears the count flag.
+ * This function disables the SysTick timer, clears the current value and the count flag, and sets the uptime back to 0.
  *
  * @param None.
  *
@@ -134,6 +167,24 @@ Std_ReturnType MCAL_SYSTICK_GetRemainingCounts(u32* Remaining_Counts);
  *     - E_OK if the reload value was set successfully.
  *     - E_NOT_OK if the reload value is out of range (see STK_RELOAD_MAX for the valid range). */
 Std_ReturnType MCAL_SYSTICK_GetElapsedCounts(u32* Elapsed_Counts);
+/**
+ * @brief Gets the monotonic uptime in microseconds.
+ *
+ * The uptime is the number of wraps counted by SysTick_Handler plus the ticks of the current period. It is read
+ * lock-free: the wrap count is read again after VAL and the read is retried if the handler ran in between, and a wrap
+ * whose handler has not run yet (caller inside a higher priority handler or with interrupts masked) is detected with
+ * the SysTick pending bit. Callable from any context, as long as SysTick_Handler is never held off for more than
+ * half a period.
+ *
+ * Measure durations and timeouts as differences of two readings: they never wrap in practice (64 bits).
+ *
+ * @param[out] Copy_TimeUs Receives the microseconds since the timebase started (or was last reset).
+ *
+ * @return
+ *     - E_OK if the uptime was read.
+ *     - E_NOT_OK if Copy_TimeUs is NULL or the timer is not running.
+ */
+Std_ReturnType MCAL_SYSTICK_GetTimeUs64(u64 *Copy_TimeUs);
 /**
  * @brief Blocks the CPU for the specified number of microseconds.
  *
@@ -141,7 +192,14 @@ Std_ReturnType MCAL_SYSTICK_GetElapsedCounts(u32* Elapsed_Counts);
  * number of ticks required to wait for the specified number of microseconds based on the current system clock frequency and
  * the reload value of the SysTick timer.
  *
- * @param[in] Copy_u32Microseconds The number of microseconds to wait. This value should be less than or equal to 16777215 (0x00FFFFFF).
+ * The delay is a deadline on the free-running counter: the timer is never stopped or reloaded, so a delay does not
+ * disturb the uptime or a running interval, and it works from any context, even with SysTick masked. The CPU sleeps
+ * between SysTick wraps while more than one timebase period remains.
+ *
+ * @note The f32 argument costs soft-float math before the wait starts; for short, exact waits use the integer
+ *       MCAL_SCB_DelayUs / MCAL_SCB_DelayNs (DWT cycle counter).
+ *
+ * @param[in] Copy_u32Microseconds The number of microseconds to wait.
  *
  *
  * @return E_OK if the delay was successful, E_NOT_OK if an error occurred.
@@ -154,7 +212,7 @@ Std_ReturnType MCAL_SYSTICK_DelayUS(f32 Copy_MicroSeconds);
  * number of ticks required to wait for the specified number of milliseconds based on the current system clock frequency and
  * the reload value of the SysTick timer.
  *
- * @param[in] Copy_Milliseconds The number of milliseconds to wait. This value should be less than or equal to 16777215 (0x00FFFFFF).
+ * @param[in] Copy_Milliseconds The number of milliseconds to wait. Same deadline behaviour as MCAL_SYSTICK_DelayUS.
  *
  * 
  * @return E_OK if the delay was successful, E_NOT_OK if an error occurred.
@@ -165,9 +223,9 @@ Std_ReturnType MCAL_SYSTICK_DelayMS(f32 Copy_MilliSeconds);
  *
  * This function sets up the SysTick timer to generate a single interrupt after the specified
  * interval in microseconds. It saves the provided callback function pointer and calculates
- * the number of ticks required for the given interval. The timer is configured for a single-shot
- * operation and starts counting down. When the timer reaches zero, the saved callback function
- * is called. Returns E_OK if the configuration was successful; otherwise, returns E_NOT_OK.
+ * the number of timebase periods required for the given interval, rounded up to whole
+ * periods. The timebase keeps running; after the interval the saved callback function is called
+ * once (never early, at most one period late). Returns E_OK if the configuration was successful; otherwise, returns E_NOT_OK.
  *
  * @param[in] Copy_Microseconds The interval in microseconds after which the timer should expire.
  * @param[in] Callback_Func      A pointer to the callback function to be executed when the timer expires.
@@ -184,15 +242,14 @@ Std_ReturnType MCAL_SYSTICK_SetIntervalSingle(f32 Copy_MicroSeconds , SYSTICK_Ca
  * @brief Configures the SysTick timer for a periodic interval and associates a callback function.
  *
  * This function sets up the SysTick timer to operate in a periodic interval mode. It calculates
- * the number of ticks required to wait for the specified duration in microseconds and configures
- * the SysTick timer's reload value accordingly. When the timer reaches zero, it generates interrupts
- * at regular intervals defined by the specified microseconds. The associated callback function
+ * the number of timebase periods required for the specified duration in microseconds, rounded up
+ * to whole periods; the reload value of the timer is not changed. The associated callback function
  * is executed upon each interrupt.
  *
  * @param[in] Copy_Microseconds The interval duration in microseconds for SysTick timer interrupts.
  * @param[in] Callback_Func A pointer to the function to be executed upon each SysTick interrupt.
  *
- * @note The maximum delay achievable with this function, when the SysTick timer clock is 1 MHz, is approximately 16 seconds.
+ * @note The interval resolution is SYSTICK_TIMEBASE_PERIOD_US.
  * @note Ensure that the callback function has a void return type and takes no parameters (void (*CallbackFunc)(void)).
  * @note This function enables the SysTick timer and its interrupt.
  *
@@ -204,6 +261,91 @@ Std_ReturnType MCAL_SYSTICK_SetIntervalSingle(f32 Copy_MicroSeconds , SYSTICK_Ca
  * @see MCAL_STK_SetIntervalSingle
  */
 Std_ReturnType MCAL_SYSTICK_SetIntervalPeriodic(f32 Copy_MicroSeconds , SYSTICK_CallbackFunc_t Callback_Func);
+/**
+ * @brief Selects where the interval callback runs.
+ *
+ * With SYSTICK_CALLBACK_DEFERRED, SysTick_Handler only posts the callback to the PendSV work queue
+ * (MCAL_SCB_PostDeferredCallback); if the queue is full or disabled, the callback runs immediately.
+ *
+ * @param[in] Copy_Mode SYSTICK_CALLBACK_IMMEDIATE or SYSTICK_CALLBACK_DEFERRED.
+ *
+ * @return
+ *     - E_OK if the mode was set.
+ *     - E_NOT_OK if the mode is invalid.
+ */
+Std_ReturnType MCAL_SYSTICK_SetCallbackMode(u8 Copy_Mode);
+/*****************************< Software timers (SYSTICK_TIMER_MODE) *****************************/
+/**
+ * @brief Prepares a timer object with its expiry function and context.
+ *
+ * @param[out] Copy_Timer The timer object; it must stay valid while the timer runs.
+ * @param[in] Copy_Func Expiry function, called with Copy_Context.
+ * @param[in] Copy_Context Passed unchanged to Copy_Func (may be NULL).
+ *
+ * @return
+ *     - E_OK if the timer was prepared.
+ *     - E_NOT_OK if a pointer is NULL, the timer is running or SYSTICK_TIMER_MODE is disabled.
+ */
+Std_ReturnType MCAL_SYSTICK_TimerCreate(SYSTICK_Timer_t *Copy_Timer , SYSTICK_TimerFunc_t Copy_Func , void *Copy_Context);
+/**
+ * @brief Starts (or restarts) a timer; O(1).
+ *
+ * Times are rounded up to whole timebase periods: the first expiry is never early and at most one period late. The
+ * expiry function runs from PendSV (see SYSTICK_TIMER_MODE) and may start or stop any timer, itself included. A
+ * periodic timer is reloaded from its previous expiry, so it does not drift; if the expiries fall behind, they are
+ * caught up.
+ *
+ * Callable from thread mode and from handlers up to SCB_CRITICAL_CEILING. Starts the timebase if needed.
+ *
+ * @param[in,out] Copy_Timer A timer prepared with MCAL_SYSTICK_TimerCreate.
+ * @param[in] Copy_DelayUs Time to the first expiry in microseconds.
+ * @param[in] Copy_PeriodUs Time between the following expiries, 0 for a one-shot timer.
+ *
+ * @return
+ *     - E_OK if the timer was started.
+ *     - E_NOT_OK if the timer was not prepared or SYSTICK_TIMER_MODE is disabled.
+ */
+Std_ReturnType MCAL_SYSTICK_TimerStart(SYSTICK_Timer_t *Copy_Timer , u32 Copy_DelayUs , u32 Copy_PeriodUs);
+/**
+ * @brief Stops a timer; O(1). Stopping an idle timer does nothing.
+ *
+ * @param[in,out] Copy_Timer The timer.
+ *
+ * @return
+ *     - E_OK if the timer is stopped.
+ *     - E_NOT_OK if Copy_Timer is NULL or SYSTICK_TIMER_MODE is disabled.
+ */
+Std_ReturnType MCAL_SYSTICK_TimerStop(SYSTICK_Timer_t *Copy_Timer);
+/**
+ * @brief Reports whether a timer is running.
+ *
+ * @param[in] Copy_Timer The timer.
+ * @param[out] Copy_IsActive Receives 1 while the timer is running, 0 otherwise.
+ *
+ * @return
+ *     - E_OK if the state was read.
+ *     - E_NOT_OK if a pointer is NULL or SYSTICK_TIMER_MODE is disabled.
+ */
+Std_ReturnType MCAL_SYSTICK_TimerIsActive(const SYSTICK_Timer_t *Copy_Timer , u8 *Copy_IsActive);
+/*****************************< Tickless idle (SYSTICK_TICKLESS_MODE) *****************************/
+/**
+ * @brief Sleeps until the next deadline without waking on every timebase period.
+ *
+ * Call it from the idle loop in place of WFI. With interrupts masked it finds the next software timer (cascades
+ * included) or interval callback deadline, reloads SysTick with the ticks up to it and enters WFI. On wake the whole
+ * periods slept are added to the uptime, the timer wheel and the interval from VAL and COUNTFLAG, and the periodic
+ * reload is restored in phase with the uptime. A sleep longer than the 24-bit counter is chained reload by reload.
+ *
+ * Returns after any other interrupt, once it has run. Below SYSTICK_TICKLESS_MIN_PERIODS it does an ordinary WFI.
+ *
+ * @note The counter is stopped for a few cycles around each reprogramming, so each tickless sleep can lose a few
+ *       ticks of uptime against the clock.
+ *
+ * @return
+ *     - E_OK after the sleep.
+ *     - E_NOT_OK if the timebase is not running or SYSTICK_TICKLESS_MODE is disabled.
+ */
+Std_ReturnType MCAL_SYSTICK_TicklessIdle(void);
 
 
 #endif /* SYSTICK_INTERFACE_H_ */
\ No newline at end of file
@@ -47,6 +47,10 @@ typedef struct
 #define SYSTICK_CTRL_TICKINT_MASK   0x00000002
 #define SYSTICK_CTRL_CLKSRC_MASK    0x00000004
 #define SYSTICK_CTRL_COUNTFLAG_MASK 0x00010000
+/*****************************< SCB_ICSR, to see (or drop) a SysTick wrap whose handler has not run yet *****************************/
+#define SYSTICK_SCB_ICSR            (*((volatile u32 *)(0xE000ED04)))
+#define SYSTICK_ICSR_PENDSTCLR_MASK 0x02000000
+#define SYSTICK_ICSR_PENDSTSET_MASK 0x04000000
 
 /**
  * @brief Specifies the clock source for the SysTick timer.
@@ -80,6 +84,10 @@ typedef struct
 #else
     #error "Wrong CLK SRC for STK"asm
 #endif
+/**
+ * @brief SysTick counter ticks per microsecond, used to convert the uptime and the delays.
+ */
+#define SYSTICK_TICKS_PER_US (STK_AHB_CLK / 1000000)
 /**
  * @brief Specifies whether the SysTick timer exception request is enabled.
  *
@@ -117,5 +125,22 @@ typedef struct
  */
 #define SYSTICK_SINGLE_INTERVAL       0
 #define SYSTICK_PERIOD_INTERVAL       1
+/*****************************< Software timer wheel *****************************/
+#define SYSTICK_TIMER_DISABLED        0
+#define SYSTICK_TIMER_ENABLED         1
+/**< Level 0 slots are one period wide, each higher level is SYSTICK_WHEEL_SLOTS times coarser */
+#define SYSTICK_WHEEL_LEVELS          4
+#define SYSTICK_WHEEL_SLOT_BITS       6
+#define SYSTICK_WHEEL_SLOTS           (1UL << SYSTICK_WHEEL_SLOT_BITS)
+#define SYSTICK_WHEEL_SLOT_MASK       (SYSTICK_WHEEL_SLOTS - 1)
+/**< Longest delta the levels can hold (2^24 - 1 periods); longer timers are parked there and re-filed when cascaded */
+#define SYSTICK_WHEEL_SPAN            ((1UL << (SYSTICK_WHEEL_LEVELS * SYSTICK_WHEEL_SLOT_BITS)) - 1)
+/**< Longest delay accepted, in periods, so expiries compare correctly across the 32-bit wrap */
+#define SYSTICK_WHEEL_MAX_DELAY       0x7FFFFFFFUL
+/*****************************< Tickless idle *****************************/
+#define SYSTICK_TICKLESS_DISABLED     0
+#define SYSTICK_TICKLESS_ENABLED      1
+/**< Idle length when nothing is due at all; the sleep is then chained in 24-bit reloads */
+#define SYSTICK_IDLE_FOREVER          0xFFFFFFFFUL
 
 #endif /* SYSTICK_PRIVATE_H_ */
\ No newline at end of file
@@ -15,12 +15,64 @@
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
 /**************************************** MCAL *****************************************************/
+#include "NVIC_stats.h"
+#include "SCB_interface.h"
 #include "SYSTICK_interface.h"
-#include "SYSTICK_private.h"
 #include "SYSTICK_config.h"
+#include "SYSTICK_private.h"
+/**************************************** Configuration Check *****************************************************/
+#if SYSTICK_TICKINT != SYSTICK_TICKINT_ENABLED
+    #error "The free-running timebase counts its periods in SysTick_Handler: SYSTICK_TICKINT must be enabled"
+#endif
+#if ( (SYSTICK_TIMEBASE_PERIOD_US * SYSTICK_TICKS_PER_US) < 2 ) || ( (SYSTICK_TIMEBASE_PERIOD_US * SYSTICK_TICKS_PER_US) > (SYSTICK_RELOAD_MAX + 1) )
+    #error "SYSTICK_TIMEBASE_PERIOD_US gives a reload value out of the 24-bit range"
+#endif
 /*====================================================   Global_Variables   ====================================================*/
-static SYSTICK_CallbackFunc_t SYSTICK_Callback=NULL;
+static SYSTICK_CallbackFunc_t volatile SYSTICK_Callback=NULL;
 static u8 SYSTICK_ModeOfInterval;
+static u8 SYSTICK_CallbackMode = SYSTICK_CALLBACK_IMMEDIATE;
+/**< Ticks of one timebase period (LOAD + 1) */
+static u32 SYSTICK_PeriodTicks = SYSTICK_TIMEBASE_PERIOD_US * SYSTICK_TICKS_PER_US;
+/**< Ticks counted up to the start of the current period; only written by SysTick_Handler and MCAL_SYSTICK_Reset */
+static volatile u64 SYSTICK_UptimeTicks = 0;
+/**< Interval callback: its length in periods and the periods left before it fires */
+static volatile u32 SYSTICK_IntervalPeriods = 0;
+static volatile u32 SYSTICK_IntervalRemaining = 0;
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+/**< Timer wheel: singly linked slot lists, each timer also keeps the pointer that points at it for O(1) removal */
+static SYSTICK_Timer_t *SYSTICK_Wheel[SYSTICK_WHEEL_LEVELS][SYSTICK_WHEEL_SLOTS];
+/**< Periods counted by SysTick_Handler (its only writer) */
+static volatile u32 SYSTICK_WheelTicks = 0;
+/**< Next period the wheel has to process; lags SYSTICK_WheelTicks until the service has run */
+static u32 SYSTICK_WheelNow = 0;
+static volatile u32 SYSTICK_ActiveTimers = 0;
+static volatile u8 SYSTICK_WheelPosted = 0;
+static u8 SYSTICK_WheelRunning = 0;
+#elif SYSTICK_TIMER_MODE != SYSTICK_TIMER_DISABLED
+    #error "Wrong SYSTICK_TIMER_MODE configuration"
+#endif
+/*====================================================   Static_Functions   ====================================================*/
+static void SYSTICK_voidConfigure(void);
+static void SYSTICK_voidStartTimebase(void);
+static void SYSTICK_voidWaitTicks(u64 Copy_Ticks);
+static Std_ReturnType SYSTICK_SetInterval(f32 Copy_MicroSeconds , SYSTICK_CallbackFunc_t Callback_Func , u8 Copy_Mode);
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+static u32 SYSTICK_u32UsToPeriods(u32 Copy_MicroSeconds);
+static void SYSTICK_voidWheelInsert(SYSTICK_Timer_t *Copy_Timer);
+static void SYSTICK_voidWheelUnlink(SYSTICK_Timer_t *Copy_Timer);
+static u32 SYSTICK_u32WheelCascade(u8 Copy_Level);
+static void SYSTICK_voidWheelService(void *Copy_Arg);
+static u32 SYSTICK_u32WheelNextWork(void);
+#endif
+#if SYSTICK_TICKLESS_MODE == SYSTICK_TICKLESS_ENABLED
+#if SYSTICK_TICKLESS_MIN_PERIODS < 2
+    #error "SYSTICK_TICKLESS_MIN_PERIODS must be 2 or more"
+#endif
+static u32 SYSTICK_u32IdlePeriods(void);
+static u8 SYSTICK_u8TicklessSleep(void);
+#elif SYSTICK_TICKLESS_MODE != SYSTICK_TICKLESS_DISABLED
+    #error "Wrong SYSTICK_TICKLESS_MODE configuration"
+#endif
 /*====================================================   Start_FUNCTION   ====================================================*/
 /**
  * @defgroup Public_Functions STK Driver
@@ -29,50 +81,27 @@ static u8 SYSTICK_ModeOfInterval;
 Std_ReturnType MCAL_SYSTICK_xINIT(u32 Copy_Ticks)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    /**< Disable SysTick timer */
-    SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-    /**< Configure SysTick timer to use the processor clock */
-    #if SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_1
-        SYSTICK->CTRL |= SYSTICK_CTRL_CLKSRC_MASK; /**< Set bit 2 to use the processor clock */
-    #elif SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_8
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_CLKSRC_MASK;  /**< Clear bit 2 to use the processor clock/8 */
-    #else
-        #error "Invalid STK_CTRL_CLKSOURCE value. Please choose STK_CTRL_CLKSOURCE_1 or STK_CTRL_CLKSOURCE_8."
-    #endif
-    /**< Generate interrupt when it reaches zero */
-    #if SYSTICK_TICKINT == SYSTICK_TICKINT_ENABLED
-        SYSTICK->CTRL |= SYSTICK_CTRL_TICKINT_MASK; /**< Set bit 1 to enable interrupt when the counter reaches zero */
-    #elif SYSTICK_TICKINT == SYSTICK_TICKINT_DISABLED
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_TICKINT_MASK; /**< Clear bit 1 to disable interrupt when the counter reaches zero */
-    #else
-        #error "Invalid STK_CTRL_TICKINT value. Please choose STK_CTRL_TICKINT_ENABLE or STK_CTRL_TICKINT_DISABLE."
-    #endif
-    /**< Load the initial value into the SysTick timer */
-    SYSTICK->LOAD = Copy_Ticks;
-    Local_FunctionStatus= E_OK;
+    /**< The period is fixed once the timebase runs, the uptime arithmetic depends on it */
+    if ( (SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) == 0 )
+    {
+        SYSTICK_voidConfigure();
+        if (MCAL_SYSTICK_SetReloadValue(Copy_Ticks) == E_OK)
+        {
+            SYSTICK_voidStartTimebase();
+            Local_FunctionStatus= E_OK;
+        }
+    }
     return Local_FunctionStatus;
 }
 Std_ReturnType MCAL_SYSTICK_vINIT()
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    /**< Disable SysTick timer */
-    SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-    /**< Configure SysTick timer to use the processor clock */
-    #if SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_1
-        SYSTICK->CTRL |= SYSTICK_CTRL_CLKSRC_MASK; /**< Set bit 2 to use the processor clock */
-    #elif SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_8
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_CLKSRC_MASK;  /**< Clear bit 2 to use the processor clock/8 */
-    #else
-        #error "Invalid STK_CTRL_CLKSOURCE value. Please choose STK_CTRL_CLKSOURCE_1 or STK_CTRL_CLKSOURCE_8."
-    #endif
-    /**< Generate interrupt when it reaches zero */
-    #if SYSTICK_TICKINT == SYSTICK_TICKINT_ENABLED
-        SYSTICK->CTRL |= SYSTICK_CTRL_TICKINT_MASK; /**< Set bit 1 to enable interrupt when the counter reaches zero */
-    #elif SYSTICK_TICKINT == SYSTICK_TICKINT_DISABLED
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_TICKINT_MASK; /**< Clear bit 1 to disable interrupt when the counter reaches zero */
-    #else
-        #error "Invalid STK_CTRL_TICKINT value. Please choose STK_CTRL_TICKINT_ENABLE or STK_CTRL_TICKINT_DISABLE."
-    #endif
+    /**< Several drivers call this: a running timebase is left alone so the uptime keeps counting */
+    if ( (SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) == 0 )
+    {
+        SYSTICK_voidConfigure();
+        SYSTICK_voidStartTimebase();
+    }
     Local_FunctionStatus= E_OK;
     return Local_FunctionStatus;
 }
@@ -80,14 +109,15 @@ Std_ReturnType MCAL_SYSTICK_vINIT()
 Std_ReturnType MCAL_SYSTICK_SetReloadValue(u32 Copy_ReloadValue)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    /**< Check if the reload value is within the valid range */ 
-    if (Copy_ReloadValue > SYSTICK_RELOAD_MAX)
+    /**< Check if the reload value is within the valid range and the timebase is stopped */ 
+    if ( (Copy_ReloadValue == 0) || (Copy_ReloadValue > SYSTICK_RELOAD_MAX) || ((SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) != 0) )
     {
         /**< Return E_NOT_OK to indicate failure */ 
         return Local_FunctionStatus;
     }
     /**< Assign the reload value to the STK_LOAD register */ 
     SYSTICK->LOAD = Copy_ReloadValue;
+    SYSTICK_PeriodTicks = Copy_ReloadValue + 1;
     /**< Return E_OK to indicate success */ 
     Local_FunctionStatus=E_OK;
 
@@ -97,8 +127,11 @@ Std_ReturnType MCAL_SYSTICK_SetReloadValue(u32 Copy_ReloadValue)
 Std_ReturnType MCAL_SYSTICK_Start()
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    /**< Enable SysTick timer */
-    SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
+    /**< Enable SysTick timer (resume the timebase) */
+    if ( (SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) == 0 )
+    {
+        SYSTICK_voidStartTimebase();
+    }
     Local_FunctionStatus=E_OK;
     return Local_FunctionStatus;
 }
@@ -106,7 +139,7 @@ Std_ReturnType MCAL_SYSTICK_Start()
 Std_ReturnType MCAL_SYSTICK_Stop()
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    /**< Disable SysTick timer */
+    /**< Disable SysTick timer, the uptime stops with it */
     SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
     Local_FunctionStatus=E_OK;
     return Local_FunctionStatus;
@@ -117,10 +150,11 @@ Std_ReturnType MCAL_SYSTICK_Reset()
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
     /**< Disable SysTick timer */
     SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-    /**< Set the reload value to 0 */
-    SYSTICK->LOAD=0;
     /**< Clear the current value */
     SYSTICK->VAL=0;
+    /**< Drop a wrap that has not been counted yet, then restart the uptime from zero */
+    SYSTICK_SCB_ICSR = SYSTICK_ICSR_PENDSTCLR_MASK;
+    SYSTICK_UptimeTicks = 0;
     /**< Clear the count flag */
     SYSTICK->CTRL &= ~SYSTICK_CTRL_COUNTFLAG_MASK;
     Local_FunctionStatus=E_OK;
@@ -139,84 +173,50 @@ Std_ReturnType MCAL_SYSTICK_GetRemainingCounts(u32* Remaining_Counts)
 Std_ReturnType MCAL_SYSTICK_GetElapsedCounts(u32* Elapsed_Counts)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-//     static u32 Local_PreviousValue =0; /**< Store the previous SysTick timer value */
-//     u32 Local_CurrentValue=SYSTICK->VAL; /**< Get the current SysTick timer value */
-//     /**< Check if the timer has wrapped around (current value is less than the previous value) */
-//     if(Local_CurrentValue < Local_PreviousValue)
-//     {
-//         /**< Calculate elapsed ticks considering timer overflow */
-//         *Elapsed_Counts = Local_PreviousValue - Local_CurrentValue;
-//     }
-//     else
-//     {
-//         /**< Calculate elapsed ticks without timer overflow */
-//         *Elapsed_Counts = (u32)SYSTICK->LOAD - (Local_CurrentValue - Local_PreviousValue);
-//    }
+    /**< Ticks elapsed in the current timebase period */
     *Elapsed_Counts=(SYSTICK->LOAD - SYSTICK->VAL);
-    /**< Update the previous value for the next call */
-   // Local_PreviousValue=Local_CurrentValue;
     Local_FunctionStatus=E_OK;
     return Local_FunctionStatus;
 }
 
-Std_ReturnType MCAL_SYSTICK_DelayUS(f32 Copy_MicroSeconds)
+Std_ReturnType MCAL_SYSTICK_GetTimeUs64(u64 *Copy_TimeUs)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    /**< Calculate the number of ticks required for the given microseconds */ 
-    u32 Local_TickRequired = (u32)(Copy_MicroSeconds * (STK_AHB_CLK / 1000000.0));
-    if (SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_8)
+    u64 Local_Base;
+    u32 Local_Value;
+    u32 Local_Pending;
+    if ( (Copy_TimeUs != NULL) && ((SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) != 0) )
     {
- 	    Local_TickRequired/=8;
-    }
-    /**< Check if the ticks required is within the valid range */ 
-    if (Local_TickRequired <= SYSTICK_RELOAD_MAX)
-   {
-        /**< Set the reload value of the SysTick timer */ 
-        SYSTICK->LOAD = Local_TickRequired;
-        /**< Enable the SysTick timer */ 
-        CLR_BIT(SYSTICK->CTRL,1);
-        MCAL_SYSTICK_Start();
-        /**< Wait until the COUNTFLAG bit is set (indicates timer has counted down to zero) */ 
-        while(GET_BIT(SYSTICK->CTRL,16)==0);
-        /**< Disable the SysTick timer */ 
-        CLR_BIT(SYSTICK->CTRL,0);
-        /**< Reset the timer value */ 
-        MCAL_SYSTICK_Reset();
-        Local_FunctionStatus= E_OK;
-    }else if(Local_TickRequired > SYSTICK_RELOAD_MAX)
-    {
-
-        /**< Calculate the number of Overflows */
-        u32 Local_OverFlowCount = Local_TickRequired / SYSTICK_RELOAD_MAX;
-        /**< Check the first timer value to get the exact delay */
-        u32 Local_InitialValue = Local_TickRequired % SYSTICK_RELOAD_MAX;
-        /**< Set the reload value of the SysTick timer */
-        SYSTICK->LOAD = Local_InitialValue;
-        /**< Enable the SysTick timer */
-        SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
-        /**< Wait until the COUNTFLAG bit is set (indicates timer has counted down to zero) */
-        while(!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG_MASK));
-        /**< Disable the SysTick timer */
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-        /**< Set the reload value of the SysTick timer for the rest of the  */
-        SYSTICK->LOAD = SYSTICK_RELOAD_MAX-1;
-        /**< Enable the SysTick timer */
-        SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
-        /**< Loop untill there's no more OVF */
-        for(u32 Local_Counter=0 ; Local_Counter<=Local_OverFlowCount ; Local_Counter++)
+        /**< Retry if SysTick_Handler moved the base while VAL was read */
+        do
+        {
+            Local_Base = SYSTICK_UptimeTicks;
+            Local_Value = SYSTICK->VAL;
+            Local_Pending = SYSTICK_SCB_ICSR & SYSTICK_ICSR_PENDSTSET_MASK;
+        }while (Local_Base != SYSTICK_UptimeTicks);
+        /**< A wrap whose handler has not run yet (caller outranks SysTick or masks it): if VAL was read after the
+             reload it is still high, and the period that just ended must be added by hand */
+        if ( (Local_Pending != 0) && (Local_Value > (SYSTICK_PeriodTicks / 2)) )
         {
-            /**< Wait until the COUNTFLAG bit is set (indicates timer has counted down to zero) */
-            while(!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG_MASK));
+            Local_Base += SYSTICK_PeriodTicks;
         }
-        /**< Disable the SysTick timer */
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-        /**< Reset the SysTick timer */
-        MCAL_SYSTICK_Reset();
+        *Copy_TimeUs = (Local_Base + (SYSTICK_PeriodTicks - 1 - Local_Value)) / SYSTICK_TICKS_PER_US;
         Local_FunctionStatus= E_OK;
+    }else
+    {
+        Local_FunctionStatus= E_NOT_OK;
     }
-    else
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_SYSTICK_DelayUS(f32 Copy_MicroSeconds)
+{
+    Std_ReturnType Local_FunctionStatus= E_NOT_OK;
+    if (Copy_MicroSeconds >= 0)
     {
-        return Local_FunctionStatus;
+        /**< Calculate the number of ticks required for the given microseconds */ 
+        SYSTICK_voidWaitTicks((u64)(Copy_MicroSeconds * SYSTICK_TICKS_PER_US));
+        Local_FunctionStatus= E_OK;
     }
     return Local_FunctionStatus;
 }
@@ -224,116 +224,172 @@ Std_ReturnType MCAL_SYSTICK_DelayUS(f32 Copy_MicroSeconds)
 Std_ReturnType MCAL_SYSTICK_DelayMS(f32 Copy_MilliSeconds)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    /**< Calculate the number of ticks required for the given microseconds */ 
-    u32 Local_TickRequired = (u32)(Copy_MilliSeconds * (STK_AHB_CLK / 1000.0));
-    if (SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_8)
+    if (Copy_MilliSeconds >= 0)
     {
- 	    Local_TickRequired/=8;
+        /**< Calculate the number of ticks required for the given milliseconds */ 
+        SYSTICK_voidWaitTicks((u64)(Copy_MilliSeconds * 1000.0f) * SYSTICK_TICKS_PER_US);
+        Local_FunctionStatus= E_OK;
     }
-    /**< Check if the ticks required is within the valid range */ 
-    if (Local_TickRequired <= SYSTICK_RELOAD_MAX)
-    {
-        /**< Set the reload value of the SysTick timer */ 
-        SYSTICK->LOAD = Local_TickRequired;
-        /**< Enable the SysTick timer */ 
-        SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
-        /**< Wait until the COUNTFLAG bit is set (indicates timer has counted down to zero) */ 
-        while(!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG_MASK));
-        /**< Disable the SysTick timer */ 
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-        /**< Reset the timer value */ 
-        MCAL_SYSTICK_Reset();
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_SYSTICK_SetIntervalSingle(f32 Copy_MicroSeconds , SYSTICK_CallbackFunc_t Callback_Func )
+{
+    return SYSTICK_SetInterval(Copy_MicroSeconds , Callback_Func , SYSTICK_SINGLE_INTERVAL);
+}
+
+Std_ReturnType MCAL_SYSTICK_SetIntervalPeriodic(f32 Copy_MicroSeconds , SYSTICK_CallbackFunc_t Callback_Func)
+{
+    return SYSTICK_SetInterval(Copy_MicroSeconds , Callback_Func , SYSTICK_PERIOD_INTERVAL);
+}
+
+Std_ReturnType MCAL_SYSTICK_SetCallbackMode(u8 Copy_Mode)
+{
+    Std_ReturnType Local_FunctionStatus= E_NOT_OK;
+    if ( (Copy_Mode == SYSTICK_CALLBACK_IMMEDIATE) || (Copy_Mode == SYSTICK_CALLBACK_DEFERRED) )
+    {
+        SYSTICK_CallbackMode = Copy_Mode;
         Local_FunctionStatus= E_OK;
-    }else if(Local_TickRequired > SYSTICK_RELOAD_MAX)
-    {
-        /**< Calculate the number of Overflows */ 
-        u32 Local_OverFlowCount = Local_TickRequired / SYSTICK_RELOAD_MAX;
-        /**< Check the first timer value to get the exact delay */  
-        u32 Local_InitialValue = Local_TickRequired % SYSTICK_RELOAD_MAX;
-        /**< Set the reload value of the SysTick timer */ 
-        SYSTICK->LOAD = Local_InitialValue;
-        /**< Enable the SysTick timer */ 
-        SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
-        /**< Wait until the COUNTFLAG bit is set (indicates timer has counted down to zero) */ 
-        while(!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG_MASK));
-        /**< Disable the SysTick timer */ 
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-        /**< Set the reload value of the SysTick timer for the rest of the  */ 
-        SYSTICK->LOAD = SYSTICK_RELOAD_MAX-1;
-        /**< Enable the SysTick timer */ 
-        SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
-        /**< Loop untill there's no more OVF */ 
-        for(u32 Local_Counter=0 ; Local_Counter<=Local_OverFlowCount ; Local_Counter++)
+    }else
+    {
+        Local_FunctionStatus= E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_SYSTICK_TimerCreate(SYSTICK_Timer_t *Copy_Timer , SYSTICK_TimerFunc_t Copy_Func , void *Copy_Context)
+{
+    Std_ReturnType Local_FunctionStatus= E_NOT_OK;
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+    if ( (Copy_Timer != NULL) && (Copy_Func != NULL) && (Copy_Timer->Link == NULL) )
+    {
+        Copy_Timer->Next = NULL;
+        Copy_Timer->Expiry = 0;
+        Copy_Timer->Period = 0;
+        Copy_Timer->Func = Copy_Func;
+        Copy_Timer->Context = Copy_Context;
+        Local_FunctionStatus= E_OK;
+    }else
+    {
+        Local_FunctionStatus= E_NOT_OK;
+    }
+#else
+    (void)Copy_Timer;
+    (void)Copy_Func;
+    (void)Copy_Context;
+#endif
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_SYSTICK_TimerStart(SYSTICK_Timer_t *Copy_Timer , u32 Copy_DelayUs , u32 Copy_PeriodUs)
+{
+    Std_ReturnType Local_FunctionStatus= E_NOT_OK;
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+    u8 Local_State;
+    u32 Local_Period;
+    if ( (Copy_Timer != NULL) && (Copy_Timer->Func != NULL) )
+    {
+        Local_Period = SYSTICK_u32UsToPeriods(Copy_PeriodUs);
+        if ( (Local_Period == 0) && (Copy_PeriodUs != 0) )
         {
-            /**< Wait until the COUNTFLAG bit is set (indicates timer has counted down to zero) */ 
-            while(!(SYSTICK->CTRL & SYSTICK_CTRL_COUNTFLAG_MASK));
+            Local_Period = 1;
         }
-        /**< Disable the SysTick timer */ 
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-        /**< Reset the SysTick timer */ 
-        MCAL_SYSTICK_Reset();
+        if ( (SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) == 0 )
+        {
+            SYSTICK_voidConfigure();
+            SYSTICK_voidStartTimebase();
+        }
+        MCAL_SCB_EnterCritical(&Local_State);
+        if (Copy_Timer->Link != NULL)
+        {
+            SYSTICK_voidWheelUnlink(Copy_Timer);
+        }else
+        {
+            /**< An empty wheel is not serviced, so it may lag: jump it to the present instead of walking empty slots */
+            if ( (SYSTICK_ActiveTimers == 0) && (SYSTICK_WheelRunning == 0) )
+            {
+                SYSTICK_WheelNow = SYSTICK_WheelTicks;
+            }
+            SYSTICK_ActiveTimers++;
+        }
+        /**< Slot T is processed on the (T + 1)th wrap, so counting from the current period is never early */
+        Copy_Timer->Expiry = SYSTICK_WheelTicks + SYSTICK_u32UsToPeriods(Copy_DelayUs);
+        Copy_Timer->Period = Local_Period;
+        SYSTICK_voidWheelInsert(Copy_Timer);
+        MCAL_SCB_ExitCritical(Local_State);
         Local_FunctionStatus= E_OK;
-    }
-    else
+    }else
     {
-        return Local_FunctionStatus;
+        Local_FunctionStatus= E_NOT_OK;
     }
+#else
+    (void)Copy_Timer;
+    (void)Copy_DelayUs;
+    (void)Copy_PeriodUs;
+#endif
     return Local_FunctionStatus;
 }
 
-Std_ReturnType MCAL_SYSTICK_SetIntervalSingle(f32 Copy_MicroSeconds , SYSTICK_CallbackFunc_t Callback_Func )
+Std_ReturnType MCAL_SYSTICK_TimerStop(SYSTICK_Timer_t *Copy_Timer)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    if(Callback_Func != NULL)
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+    u8 Local_State;
+    if (Copy_Timer != NULL)
     {
-        /**< Save the callback function pointer */
-        SYSTICK_Callback = Callback_Func;
-        /* Calculate the number of ticks required to wait for the specified number of microseconds */
-        u32 Local_TickRequired = (u32)(Copy_MicroSeconds * (STK_AHB_CLK / 1000000));
-        if (SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_8)
+        MCAL_SCB_EnterCritical(&Local_State);
+        if (Copy_Timer->Link != NULL)
         {
-     	    Local_TickRequired/=8;
+            SYSTICK_voidWheelUnlink(Copy_Timer);
+            SYSTICK_ActiveTimers--;
         }
-       // Local_TickRequired/=8;
-        /* Set the reload value for the SysTick timer */
-        SYSTICK->LOAD = Local_TickRequired;
-        /**< Set the Mode of interval to be single */
-        SYSTICK_ModeOfInterval=SYSTICK_SINGLE_INTERVAL;
-        /* Start the SysTick timer and enable the interrupt */
-        MCAL_SYSTICK_Start();
-        /**< Configured successfully */
+        MCAL_SCB_ExitCritical(Local_State);
         Local_FunctionStatus= E_OK;
     }else
     {
-        /**< Invalid callback function pointer */
         Local_FunctionStatus= E_NOT_OK;
     }
+#else
+    (void)Copy_Timer;
+#endif
     return Local_FunctionStatus;
 }
 
-Std_ReturnType MCAL_SYSTICK_SetIntervalPeriodic(f32 Copy_MicroSeconds , SYSTICK_CallbackFunc_t Callback_Func)
+Std_ReturnType MCAL_SYSTICK_TimerIsActive(const SYSTICK_Timer_t *Copy_Timer , u8 *Copy_IsActive)
 {
     Std_ReturnType Local_FunctionStatus= E_NOT_OK;
-    if(Callback_Func != NULL)
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+    if ( (Copy_Timer != NULL) && (Copy_IsActive != NULL) )
     {
-        /**< Save the callback function pointer */
-        SYSTICK_Callback = Callback_Func;
-        /* Calculate the number of ticks required to wait for the specified number of microseconds */
-        u32 Local_TickRequired = (u32)(Copy_MicroSeconds * (STK_AHB_CLK / 1000000));
-        /* Set the reload value for the SysTick timer */
-        SYSTICK->LOAD = Local_TickRequired-1;
-        /**< Set the Mode of interval to be periodic */
-        SYSTICK_ModeOfInterval=SYSTICK_PERIOD_INTERVAL;
-        /* Start the SysTick timer and enable the interrupt */
-        SYSTICK->CTRL |= SYSTICK_CTRL_TICKINT_MASK;
-        SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
-        /**< Configured successfully */
+        *Copy_IsActive = (Copy_Timer->Link != NULL) ? 1 : 0;
         Local_FunctionStatus= E_OK;
     }else
     {
-        /**< Invalid callback function pointer */
         Local_FunctionStatus= E_NOT_OK;
     }
+#else
+    (void)Copy_Timer;
+    (void)Copy_IsActive;
+#endif
+    return Local_FunctionStatus;
+}
+
+Std_ReturnType MCAL_SYSTICK_TicklessIdle(void)
+{
+    Std_ReturnType Local_FunctionStatus= E_NOT_OK;
+#if SYSTICK_TICKLESS_MODE == SYSTICK_TICKLESS_ENABLED
+    if ( (SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) != 0 )
+    {
+        /**< Chain reloads while each one ran out without anything else waking the core */
+        while (SYSTICK_u8TicklessSleep() == 1)
+        {
+        }
+        Local_FunctionStatus= E_OK;
+    }else
+    {
+        Local_FunctionStatus= E_NOT_OK;
+    }
+#endif
     return Local_FunctionStatus;
 }
 /**
@@ -346,25 +402,472 @@ Std_ReturnType MCAL_SYSTICK_SetIntervalPeriodic(f32 Copy_MicroSeconds , SYSTICK_
  */
 void SysTick_Handler(void)
 {
-    if (SYSTICK_Callback != NULL)
+    SYSTICK_CallbackFunc_t Local_Callback = SYSTICK_Callback;
+    NVIC_STATS_ENTER();
+    /**< One more period of uptime */
+    SYSTICK_UptimeTicks += SYSTICK_PeriodTicks;
+    if (Local_Callback != NULL)
+    {
+        SYSTICK_IntervalRemaining--;
+        if (SYSTICK_IntervalRemaining == 0)
+        {
+            if (SYSTICK_ModeOfInterval == SYSTICK_SINGLE_INTERVAL)
+            {
+                /**< A single interval fires once; the timebase keeps running */
+                SYSTICK_Callback = NULL;
+            }else
+            {
+                SYSTICK_IntervalRemaining = SYSTICK_IntervalPeriods;
+            }
+            /**< Callback notification, from PendSV when deferred (or here if it could not be queued) */
+            if ( (SYSTICK_CallbackMode == SYSTICK_CALLBACK_IMMEDIATE) || (MCAL_SCB_PostDeferredCallback(Local_Callback) != E_OK) )
+            {
+                Local_Callback();
+            }
+        }
+    }
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+    SYSTICK_WheelTicks++;
+    /**< One service request covers every period that elapses until it runs */
+    if ( (SYSTICK_ActiveTimers != 0) && (SYSTICK_WheelPosted == 0) )
     {
-        if (SYSTICK_ModeOfInterval == SYSTICK_SINGLE_INTERVAL)
+        SYSTICK_WheelPosted = 1;
+        if (MCAL_SCB_PostDeferred(SYSTICK_voidWheelService , NULL) != E_OK)
         {
-            /**< Disable interrupt when the counter reaches zero */
-            SYSTICK->CTRL &= ~SYSTICK_CTRL_TICKINT_MASK;
-            /**< Disable SysTick timer */
-            SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
-            /**< Clear the current value */
-            SYSTICK->LOAD=0;
-            /**< Set the reload value to 0 */
-            SYSTICK->VAL=0;
+            SYSTICK_voidWheelService(NULL);
         }
-        /**< Callback notification */
-        SYSTICK_Callback();
-        /**< Clear the count/interrupt flag */
-        SYSTICK->CTRL &= ~SYSTICK_CTRL_COUNTFLAG_MASK;
     }
+#endif
+    NVIC_STATS_EXIT(NVIC_STATS_SYSTICK);
 }
 /**
  * @} // End of IRQ_Handlers
  */
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void SYSTICK_voidConfigure(void)
+{
+    /**< Configure SysTick timer to use the processor clock */
+    #if SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_1
+        SYSTICK->CTRL |= SYSTICK_CTRL_CLKSRC_MASK; /**< Set bit 2 to use the processor clock */
+    #elif SYSTICK_AHB_CLKSRC == SYSTICK_CLKSRC_DIV_8
+        SYSTICK->CTRL &= ~SYSTICK_CTRL_CLKSRC_MASK;  /**< Clear bit 2 to use the processor clock/8 */
+    #else
+        #error "Invalid STK_CTRL_CLKSOURCE value. Please choose STK_CTRL_CLKSOURCE_1 or STK_CTRL_CLKSOURCE_8."
+    #endif
+    /**< Generate interrupt when it reaches zero: each one is a period of uptime */
+    SYSTICK->CTRL |= SYSTICK_CTRL_TICKINT_MASK;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void SYSTICK_voidStartTimebase(void)
+{
+    SYSTICK->LOAD = SYSTICK_PeriodTicks - 1;
+    SYSTICK->CTRL |= SYSTICK_CTRL_TICKINT_MASK;
+    SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Waits Copy_Ticks SysTick ticks without touching the timer.
+ *
+ * Elapsed ticks are summed from VAL differences, so the wait also works where SysTick_Handler cannot run (a higher
+ * priority handler, masked interrupts) as long as VAL is read at least once per period. It only sleeps while the
+ * SysTick exception is free to run, so the next wrap wakes it.
+ */
+static void SYSTICK_voidWaitTicks(u64 Copy_Ticks)
+{
+    u32 Local_Last;
+    u32 Local_Now;
+    u32 Local_Elapsed;
+    if ( (SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) == 0 )
+    {
+        SYSTICK_voidConfigure();
+        SYSTICK_voidStartTimebase();
+    }
+    Local_Last = SYSTICK->VAL;
+    while (Copy_Ticks > 0)
+    {
+        if ( (Copy_Ticks > SYSTICK_PeriodTicks) && ((SYSTICK_SCB_ICSR & SYSTICK_ICSR_PENDSTSET_MASK) == 0) )
+        {
+            MCAL_SCB_BlockingWait();
+        }
+        Local_Now = SYSTICK->VAL;
+        /**< The counter counts down and reloads to LOAD after 0 */
+        Local_Elapsed = (Local_Last >= Local_Now) ? (Local_Last - Local_Now) : (Local_Last + SYSTICK_PeriodTicks - Local_Now);
+        Local_Last = Local_Now;
+        Copy_Ticks = (Local_Elapsed >= Copy_Ticks) ? 0 : (Copy_Ticks - Local_Elapsed);
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Arms the interval callback on the running timebase.
+ *
+ * The interval is rounded up to whole periods and one period is added, because the current period is already under
+ * way: the callback never comes early and is at most one period late.
+ */
+static Std_ReturnType SYSTICK_SetInterval(f32 Copy_MicroSeconds , SYSTICK_CallbackFunc_t Callback_Func , u8 Copy_Mode)
+{
+    Std_ReturnType Local_FunctionStatus= E_NOT_OK;
+    u32 Local_Periods;
+    if( (Callback_Func != NULL) && (Copy_MicroSeconds >= 0) )
+    {
+        /* Calculate the number of periods required to wait for the specified number of microseconds */
+        Local_Periods = (u32)( ((Copy_MicroSeconds * SYSTICK_TICKS_PER_US) + (f32)(SYSTICK_PeriodTicks - 1)) / (f32)SYSTICK_PeriodTicks );
+        if (Local_Periods == 0)
+        {
+            Local_Periods = 1;
+        }
+        /**< Unpublish the callback while its counters change, so the handler never sees them half written */
+        SYSTICK_Callback = NULL;
+        SYSTICK_ModeOfInterval = Copy_Mode;
+        SYSTICK_IntervalPeriods = Local_Periods;
+        SYSTICK_IntervalRemaining = (Copy_Mode == SYSTICK_SINGLE_INTERVAL) ? (Local_Periods + 1) : Local_Periods;
+        SYSTICK_Callback = Callback_Func;
+        if ( (SYSTICK->CTRL & SYSTICK_CTRL_ENABLE_MASK) == 0 )
+        {
+            SYSTICK_voidConfigure();
+            SYSTICK_voidStartTimebase();
+        }
+        /**< Configured successfully */
+        Local_FunctionStatus= E_OK;
+    }else
+    {
+        /**< Invalid callback function pointer */
+        Local_FunctionStatus= E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+/*====================================================   Start_FUNCTION   ====================================================*/
+static u32 SYSTICK_u32UsToPeriods(u32 Copy_MicroSeconds)
+{
+    /**< The period in use, which MCAL_SYSTICK_SetReloadValue may have changed from SYSTICK_TIMEBASE_PERIOD_US */
+    u64 Local_Periods = ( ((u64)Copy_MicroSeconds * SYSTICK_TICKS_PER_US) + (SYSTICK_PeriodTicks - 1) ) / SYSTICK_PeriodTicks;
+    return (Local_Periods > SYSTICK_WHEEL_MAX_DELAY) ? SYSTICK_WHEEL_MAX_DELAY : (u32)Local_Periods;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Files a timer in the slot of its expiry; called with the critical section held.
+ *
+ * The level is the smallest one whose range covers the distance to the expiry, the slot is the expiry's digit at that
+ * level. Overdue timers go to the slot being processed, timers beyond the wheel span are parked at its far end.
+ */
+static void SYSTICK_voidWheelInsert(SYSTICK_Timer_t *Copy_Timer)
+{
+    u32 Local_Delta = Copy_Timer->Expiry - SYSTICK_WheelNow;
+    u32 Local_Target = Copy_Timer->Expiry;
+    u8 Local_Level = 0;
+    SYSTICK_Timer_t **Local_Head;
+    if (Local_Delta > SYSTICK_WHEEL_MAX_DELAY)
+    {
+        Local_Target = SYSTICK_WheelNow;
+    }else
+    {
+        if (Local_Delta > SYSTICK_WHEEL_SPAN)
+        {
+            Local_Delta = SYSTICK_WHEEL_SPAN;
+            Local_Target = SYSTICK_WheelNow + SYSTICK_WHEEL_SPAN;
+        }
+        while ( (Local_Level < (SYSTICK_WHEEL_LEVELS - 1)) && ( (Local_Delta >> (SYSTICK_WHEEL_SLOT_BITS * (Local_Level + 1))) != 0 ) )
+        {
+            Local_Level++;
+        }
+    }
+    Local_Head = &SYSTICK_Wheel[Local_Level][(Local_Target >> (SYSTICK_WHEEL_SLOT_BITS * Local_Level)) & SYSTICK_WHEEL_SLOT_MASK];
+    Copy_Timer->Next = *Local_Head;
+    if (*Local_Head != NULL)
+    {
+        (*Local_Head)->Link = &Copy_Timer->Next;
+    }
+    Copy_Timer->Link = Local_Head;
+    *Local_Head = Copy_Timer;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void SYSTICK_voidWheelUnlink(SYSTICK_Timer_t *Copy_Timer)
+{
+    *Copy_Timer->Link = Copy_Timer->Next;
+    if (Copy_Timer->Next != NULL)
+    {
+        Copy_Timer->Next->Link = Copy_Timer->Link;
+    }
+    Copy_Timer->Next = NULL;
+    Copy_Timer->Link = NULL;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Re-files the timers of the current slot of Copy_Level into the lower levels.
+ *
+ * @return The slot index, 0 when this level wrapped too and the next level must be cascaded.
+ */
+static u32 SYSTICK_u32WheelCascade(u8 Copy_Level)
+{
+    u32 Local_Index = (SYSTICK_WheelNow >> (SYSTICK_WHEEL_SLOT_BITS * Copy_Level)) & SYSTICK_WHEEL_SLOT_MASK;
+    SYSTICK_Timer_t *Local_Timer = SYSTICK_Wheel[Copy_Level][Local_Index];
+    SYSTICK_Timer_t *Local_Next;
+    SYSTICK_Wheel[Copy_Level][Local_Index] = NULL;
+    while (Local_Timer != NULL)
+    {
+        Local_Next = Local_Timer->Next;
+        SYSTICK_voidWheelInsert(Local_Timer);
+        Local_Timer = Local_Next;
+    }
+    return Local_Index;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Brings the wheel up to the periods counted by SysTick_Handler and runs the expired timers.
+ *
+ * Runs from PendSV (or from SysTick_Handler without the deferred queue). The wheel is only touched inside the critical
+ * section; it is left around each expiry function, which may start and stop timers.
+ */
+static void SYSTICK_voidWheelService(void *Copy_Arg)
+{
+    u8 Local_State;
+    u8 Local_Level;
+    SYSTICK_Timer_t *Local_Timer;
+    SYSTICK_TimerFunc_t Local_Func;
+    void *Local_Context;
+    (void)Copy_Arg;
+    SYSTICK_WheelPosted = 0;
+    MCAL_SCB_EnterCritical(&Local_State);
+    SYSTICK_WheelRunning = 1;
+    while ( (s32)(SYSTICK_WheelTicks - SYSTICK_WheelNow) > 0 )
+    {
+        if (SYSTICK_ActiveTimers == 0)
+        {
+            SYSTICK_WheelNow = SYSTICK_WheelTicks;
+            break;
+        }
+        /**< Level 0 wrapped: pull the next slot of level 1 down, and so on up the levels */
+        if ( (SYSTICK_WheelNow & SYSTICK_WHEEL_SLOT_MASK) == 0 )
+        {
+            Local_Level = 1;
+            while ( (Local_Level < SYSTICK_WHEEL_LEVELS) && (SYSTICK_u32WheelCascade(Local_Level) == 0) )
+            {
+                Local_Level++;
+            }
+        }
+        /**< Take the expired timers one at a time, the slot may change while an expiry function runs */
+        Local_Timer = SYSTICK_Wheel[0][SYSTICK_WheelNow & SYSTICK_WHEEL_SLOT_MASK];
+        while (Local_Timer != NULL)
+        {
+            SYSTICK_voidWheelUnlink(Local_Timer);
+            if (Local_Timer->Period != 0)
+            {
+                Local_Timer->Expiry += Local_Timer->Period;
+                SYSTICK_voidWheelInsert(Local_Timer);
+            }else
+            {
+                SYSTICK_ActiveTimers--;
+            }
+            Local_Func = Local_Timer->Func;
+            Local_Context = Local_Timer->Context;
+            MCAL_SCB_ExitCritical(Local_State);
+            Local_Func(Local_Context);
+            MCAL_SCB_EnterCritical(&Local_State);
+            Local_Timer = SYSTICK_Wheel[0][SYSTICK_WheelNow & SYSTICK_WHEEL_SLOT_MASK];
+        }
+        SYSTICK_WheelNow++;
+    }
+    SYSTICK_WheelRunning = 0;
+    MCAL_SCB_ExitCritical(Local_State);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Distance in periods from SYSTICK_WheelNow to the first slot the service has work in.
+ *
+ * That is the first non-empty level 0 slot or the first cascade of a non-empty higher level slot, whichever comes
+ * first; the slots before it can be skipped without walking them. Scans at most 256 slots, only used before sleeping.
+ */
+static u32 SYSTICK_u32WheelNextWork(void)
+{
+    u32 Local_Best = SYSTICK_IDLE_FOREVER;
+    u32 Local_Base;
+    u32 Local_Delta;
+    u32 Local_Offset;
+    u32 Local_First;
+    u8 Local_Level;
+    for (Local_Offset = 0 ; Local_Offset < SYSTICK_WHEEL_SLOTS ; Local_Offset++)
+    {
+        if (SYSTICK_Wheel[0][(SYSTICK_WheelNow + Local_Offset) & SYSTICK_WHEEL_SLOT_MASK] != NULL)
+        {
+            Local_Best = Local_Offset;
+            break;
+        }
+    }
+    for (Local_Level = 1 ; Local_Level < SYSTICK_WHEEL_LEVELS ; Local_Level++)
+    {
+        Local_Base = SYSTICK_WheelNow >> (SYSTICK_WHEEL_SLOT_BITS * Local_Level);
+        /**< The current slot of a higher level is cascaded when the lower digits are all zero, i.e. still ahead at such
+             a boundary, and otherwise already done and only seen again one turn later */
+        Local_First = ( (SYSTICK_WheelNow & ((1UL << (SYSTICK_WHEEL_SLOT_BITS * Local_Level)) - 1)) == 0 ) ? 0 : 1;
+        for (Local_Offset = Local_First ; Local_Offset < (Local_First + SYSTICK_WHEEL_SLOTS) ; Local_Offset++)
+        {
+            if (SYSTICK_Wheel[Local_Level][(Local_Base + Local_Offset) & SYSTICK_WHEEL_SLOT_MASK] != NULL)
+            {
+                Local_Delta = ((Local_Base + Local_Offset) << (SYSTICK_WHEEL_SLOT_BITS * Local_Level)) - SYSTICK_WheelNow;
+                if (Local_Delta < Local_Best)
+                {
+                    Local_Best = Local_Delta;
+                }
+                break;
+            }
+        }
+    }
+    return Local_Best;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#endif
+#if SYSTICK_TICKLESS_MODE == SYSTICK_TICKLESS_ENABLED
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Number of timebase wraps the core may sleep through; called with interrupts masked.
+ */
+static u32 SYSTICK_u32IdlePeriods(void)
+{
+    u32 Local_Periods = SYSTICK_IDLE_FOREVER;
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+    u32 Local_Work;
+#endif
+    /**< The interval callback runs on the wrap that brings its count to zero */
+    if ( (SYSTICK_Callback != NULL) && (SYSTICK_IntervalRemaining < Local_Periods) )
+    {
+        Local_Periods = SYSTICK_IntervalRemaining;
+    }
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+    if (SYSTICK_ActiveTimers != 0)
+    {
+        if ( (SYSTICK_WheelNow != SYSTICK_WheelTicks) || (SYSTICK_WheelPosted != 0) )
+        {
+            /**< The service has not caught up yet */
+            Local_Periods = 0;
+        }else
+        {
+            /**< Slot T is processed on wrap T + 1 */
+            Local_Work = SYSTICK_u32WheelNextWork();
+            if ( (Local_Work != SYSTICK_IDLE_FOREVER) && ((Local_Work + 1) < Local_Periods) )
+            {
+                Local_Periods = Local_Work + 1;
+            }
+        }
+    }
+#endif
+    return Local_Periods;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief One tickless sleep: reload up to the deadline (or the 24-bit limit), WFI, then account and restore the period.
+ *
+ * @return 1 when the reload ran out before the deadline with nothing else waking the core, so the caller sleeps again.
+ */
+static u8 SYSTICK_u8TicklessSleep(void)
+{
+    u8 Local_Chain = 0;
+    u32 Local_PriMask;
+    u32 Local_Periods;
+    u32 Local_MaxPeriods;
+    u32 Local_Value;
+    u32 Local_Reload;
+    u32 Local_Ctrl;
+    u32 Local_Done;
+    u32 Local_Elapsed;
+    u32 Local_Left;
+    /**< PRIMASK, not BASEPRI: a BASEPRI-masked SysTick would not wake WFI */
+    MCAL_SCB_EnterSleepCritical(&Local_PriMask);
+    Local_Periods = SYSTICK_u32IdlePeriods();
+    if (Local_Periods < SYSTICK_TICKLESS_MIN_PERIODS)
+    {
+        /**< Something is due within a period or two: keep the periodic tick */
+        MCAL_SCB_WaitForInterrupt();
+    }else
+    {
+        /**< Stop the counter; it stands still until restarted, which the uptime loses */
+        SYSTICK->CTRL &= ~SYSTICK_CTRL_ENABLE_MASK;
+        Local_Value = SYSTICK->VAL;
+        if ( ((SYSTICK_SCB_ICSR & SYSTICK_ICSR_PENDSTSET_MASK) != 0) || (Local_Value == 0) )
+        {
+            /**< The period has just ended: let SysTick_Handler count it first */
+            SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
+        }else
+        {
+            /**< Sleep to the end of the current period plus whole periods, as long as it fits the 24-bit reload */
+            Local_MaxPeriods = ((SYSTICK_RELOAD_MAX - Local_Value) / SYSTICK_PeriodTicks) + 1;
+            if (Local_Periods > Local_MaxPeriods)
+            {
+                Local_Periods = Local_MaxPeriods;
+                Local_Chain = 1;
+            }
+            /**< Restarting from VAL = 0 spends one tick on the reload, so a LOAD of n reaches 0 after n + 1 ticks; without
+                 the - 1 every sleep ends a tick late and the timebase drifts by that much per sleep */
+            Local_Reload = Local_Value + ((Local_Periods - 1) * SYSTICK_PeriodTicks) - 1;
+            SYSTICK->LOAD = Local_Reload;
+            SYSTICK->VAL = 0;
+            SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
+            MCAL_SCB_WaitForInterrupt();
+            /**< Reading CTRL clears COUNTFLAG, so it is read once */
+            Local_Ctrl = SYSTICK->CTRL;
+            SYSTICK->CTRL = Local_Ctrl & ~SYSTICK_CTRL_ENABLE_MASK;
+            Local_Value = SYSTICK->VAL;
+            if ( (Local_Ctrl & SYSTICK_CTRL_COUNTFLAG_MASK) != 0 )
+            {
+                /**< Ran to the deadline: the pending SysTick exception counts the last period, VAL counts from the
+                     long reload since then (VAL still 0 right at the wrap gives a full period left) */
+                Local_Done = Local_Periods - 1;
+                Local_Elapsed = (Local_Reload - Local_Value) + 1;
+                Local_Left = (Local_Elapsed < (SYSTICK_PeriodTicks - 1)) ? (SYSTICK_PeriodTicks - Local_Elapsed) : SYSTICK_PeriodTicks;
+            }else
+            {
+                /**< Woken early by another interrupt: count the whole periods slept and keep the phase of the current one */
+                if (Local_Value == 0)
+                {
+                    /**< Woken before the reload tick: nothing of the long reload has elapsed yet */
+                    Local_Value = Local_Reload + 1;
+                }
+                Local_Elapsed = (Local_Periods * SYSTICK_PeriodTicks) - Local_Value;
+                Local_Done = Local_Elapsed / SYSTICK_PeriodTicks;
+                Local_Left = ((Local_Done + 1) * SYSTICK_PeriodTicks) - Local_Elapsed;
+                Local_Chain = 0;
+            }
+            /**< A reload of 1 would fire twice before it can be replaced, a reload of 0 never */
+            if (Local_Left < 2)
+            {
+                Local_Left = 2;
+            }
+            /**< Finish the current period with a short reload, then put the period back once it has been taken */
+            SYSTICK->LOAD = Local_Left - 1;
+            SYSTICK->VAL = 0;
+            SYSTICK->CTRL |= SYSTICK_CTRL_ENABLE_MASK;
+            while (SYSTICK->VAL == 0)
+            {
+            }
+            SYSTICK->LOAD = SYSTICK_PeriodTicks - 1;
+            /**< Account the periods SysTick_Handler did not see; nothing was due in them */
+            SYSTICK_UptimeTicks += (u64)Local_Done * SYSTICK_PeriodTicks;
+            if (SYSTICK_Callback != NULL)
+            {
+                SYSTICK_IntervalRemaining -= Local_Done;
+            }
+#if SYSTICK_TIMER_MODE == SYSTICK_TIMER_ENABLED
+            SYSTICK_WheelTicks += Local_Done;
+            if (SYSTICK_ActiveTimers != 0)
+            {
+                /**< The skipped slots hold no work, so the wheel jumps over them */
+                SYSTICK_WheelNow += Local_Done;
+            }
+#endif
+        }
+    }
+    /**< Pending interrupts, SysTick included, run here */
+    MCAL_SCB_ExitSleepCritical(Local_PriMask);
+    return Local_Chain;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#endif
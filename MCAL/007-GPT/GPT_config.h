@@ -41,5 +41,14 @@ Options:
 */
 #define TIM_Ratio		MilliSeconds
 
+/*
+ * Encoder velocity estimator (GPT_Encoder_GetVelocity)
+ * GPT_ENCODER_LOW_SPEED_COUNTS: below this many counts between two calls the velocity is measured from the time
+ *                               between captured encoder edges instead of the count delta.
+ * GPT_ENCODER_STOP_US:          with no edge for this long the velocity reads 0 (must stay below 2^32 core cycles).
+ */
+#define GPT_ENCODER_LOW_SPEED_COUNTS    4
+#define GPT_ENCODER_STOP_US             500000UL
+
 
 #endif /* GPT_CONFIG_H_ */
\ No newline at end of file
@@ -41,16 +41,30 @@
  */
 /*******************************< CR1 *******************************/
 #define TIMX_CR1_CEN    0
+#define TIMX_CR1_OPM    3
 #define TIMX_CR1_DIR    4
 #define TIMX_CR1_CMS0   5
 #define TIMX_CR1_CMS1   6
 #define TIMx_CR1_ARPE   7
 #define TIMX_CR1_CKD0   8
 #define TIMX_CR1_CKD1   9
+/*******************************< CR2 *******************************/
+#define TIMX_CR2_MMS        4
+#define TIMX_CR2_MMS_MASK   0x0070
+#define TIMX_CR2_MMS_UPDATE 2       /**< TRGO = update event                                  */
+#define TIMX_CR2_MMS_CC1    3       /**< TRGO = pulse on each CC1 capture or compare match    */
 /*******************************< DIER *******************************/
 #define TIMX_DIER_UIE   0
+#define TIMX_DIER_UDE   8
+#define TIMX_DIER_CC1IE 1
+#define TIMX_DIER_CC2IE 2
 /*******************************< SR *******************************/
 #define TIMX_SR_UIF     0
+#define TIMX_SR_CC1IF   1
+#define TIMX_SR_CC2IF   2
+#define TIMX_SR_CC1OF   9
+#define TIMX_SR_CC2OF   10
+#define TIMX_SR_BIF     7
 /*******************************< EGR *******************************/
 #define TIMX_EGR_UG     0
 /*******************************< CCMR1 *******************************/
@@ -59,6 +73,42 @@
 /*******************************< CCMR2 *******************************/
 #define TIMX_CCMR2_OC3PE 3
 #define TIMX_CCMR2_OC4PE 11
+/*******************************< CCMRx input capture fields (per channel byte) *******************************/
+#define TIMX_CCMR_CCS       0       /**< CCxS: 01 TIx, 10 the neighbour TIy, 11 TRC      */
+#define TIMX_CCMR_ICPSC     2       /**< ICxPSC: capture every 1/2/4/8 events             */
+#define TIMX_CCMR_ICF       4       /**< ICxF: digital filter                             */
+#define TIMX_CCMR_CH_MASK   0xFF
+#define TIMX_CCMR_ICF_MAX   15
+/*******************************< SMCR *******************************/
+#define TIMX_SMCR_SMS       0
+#define TIMX_SMCR_SMS_MASK  0x0007
+#define TIMX_SMCR_TS        4
+#define TIMX_SMCR_TS_MASK   0x0070
+#define TIMX_SMCR_SMS_RESET     4   /**< Reset mode: the trigger reinitializes the counter */
+#define TIMX_SMCR_TS_TI1FP1     5   /**< Trigger: filtered timer input 1                   */
+#define TIMX_SMCR_SMS_EXT_CLK1  7   /**< External clock mode 1: the trigger clocks the counter */
+/*******************************< Timer chaining *******************************/
+/**
+ * ITRx of a slave timer, indexed by the master timer. On the STM32F103 every ITR slot of TIM1..TIM4 that is not wired
+ * to TIM5/TIM8 is wired to the timer of the same index (ITR0 = TIM1, ITR1 = TIM2, ITR2 = TIM3, ITR3 = TIM4).
+ */
+#define GPT_CHAIN_ITR(MASTER)   (MASTER)
+/**< Low counter values below which the slave may not have counted the wrap yet (2-3 timer clocks of resync) */
+#define GPT_CHAIN_SYNC_TICKS    4
+/*******************************< DCR *******************************/
+#define TIMX_DCR_DBA        0       /**< First register of the burst, in 32-bit words from CR1 */
+#define TIMX_DCR_DBL        8       /**< Burst length - 1                                      */
+#define GPT_BURST_DBA_ARR   11      /**< ARR, then RCR, CCR1 .. CCR4                           */
+#define GPT_BURST_DBA_CCR1  13      /**< CCR1 .. CCR4                                          */
+/*******************************< Encoder interface *******************************/
+#define GPT_ENCODER_HALF_RANGE  0x8000  /**< CNT below this at an update: the counter wrapped upwards */
+#define GPT_ENCODER_CC1_FLAGS   ( (1 << TIMX_SR_CC1IF) | (1 << TIMX_SR_CC1OF) )
+/**< DIER bits owned by the encoder: wrap tracking and the TI1 edge interrupt */
+#define GPT_ENCODER_DIER_MASK   ( (1 << TIMX_DIER_UIE) | (1 << TIMX_DIER_CC1IE) | (1 << TIMX_DIER_CC2IE) )
+#define GPT_ENCODER_EDGE_IE     (1 << TIMX_DIER_CC1IE)
+/**< Core cycles per tick of the timestamp timer (PSC = 0); TIMxCLK is HCLK divided by 1, 2, 4 or 8 */
+#define GPT_ENCODER_CYCLES_PER_TICK (SYSTEM_CLOCK_FREQUENCY / TIM_Clk_Freq)
+#define GPT_ENCODER_STOP_CYCLES ( (u32)GPT_ENCODER_STOP_US * (SYSTEM_CLOCK_FREQUENCY / 1000000UL) )
 /*******************************< CCER *******************************/
 #define TIMX_CCER_CC1E  0
 #define TIMX_CCER_CC1P  1
@@ -68,8 +118,26 @@
 #define TIMX_CCER_CC3P  9
 #define TIMX_CCER_CC4E  12
 #define TIMX_CCER_CC4P  13
+#define TIMX_CCER_CC1NE 2
+#define TIMX_CCER_CC1NP 3
 /*******************************< BTDR *******************************/
 #define TIMX_BDTR_MOE 15
+#define TIMX_BDTR_DTG       0       /**< Dead-time generator setup, 8 bits                    */
+#define TIMX_BDTR_LOCK      8       /**< Lock level, 2 bits, writable once after reset        */
+#define TIMX_BDTR_OSSI      10
+#define TIMX_BDTR_OSSR      11
+#define TIMX_BDTR_BKE       12
+#define TIMX_BDTR_BKP       13
+#define TIMX_BDTR_AOE       14
+/**< DTG ranges, in dead-time clock (tDTS) cycles: DTG 0xxxxxxx, 10xxxxxx, 110xxxxx, 111xxxxx */
+#define GPT_DTG_MAX_DIRECT  127
+#define GPT_DTG_MAX_X2      254
+#define GPT_DTG_MAX_X8      504
+#define GPT_DTG_MAX_X16     1008
+#define GPT_DTG_X2          0x80
+#define GPT_DTG_X8          0xC0
+#define GPT_DTG_X16         0xE0
+#define GPT_NS_PER_S        1000000000ULL
 /**
  * @brief GPT Register Map.
  *
@@ -138,30 +206,6 @@ volatile GPT_TIM_RegDef_t* TIM[TIM_IN_STM32F103C6]={
 #define MilliSeconds    0
 /**< Macro for the seconds */
 #define Seconds         1
-/**
- * @brief Enables the specified General Purpose Timer (GPT).
- *
- * This function enables the General Purpose Timer (GPT) indicated by 'Copy_GPT_TIMx'.
- *
- * @param[in] Copy_GPT_TIMx The identifier for the GPT timer to be enabled.
- *
- * @return Std_ReturnType
- *   - E_OK     : GPT enabled successfully.
- *   - E_NOT_OK : Error occurred while enabling GPT or invalid parameters.
- */
-Std_ReturnType GPT_TIMx_Enable(u8 Copy_GPT_TIMx);
-/**
- * @brief Disables the specified General Purpose Timer (GPT).
- *
- * This function disables the General Purpose Timer (GPT) indicated by 'Copy_GPT_TIMx'.
- *
- * @param[in] Copy_GPT_TIMx The identifier for the GPT timer to be disabled.
- *
- * @return Std_ReturnType
- *   - E_OK     : GPT disabled successfully.
- *   - E_NOT_OK : Error occurred while disabling GPT or invalid parameters.
- */
-Std_ReturnType GPT_TIMx_Disable(u8 Copy_GPT_TIMx);
 /**
  * @brief Sets the prescaler value for the specified General Purpose Timer (GPT).
  *
@@ -20,6 +20,10 @@
 #include "STM32F103C8.h"
 /**************************************** MCAL *****************************************************/
 #include "RCC_interface.h"
+#include "NVIC_interface.h"
+#include "NVIC_stats.h"
+#include "SCB_interface.h"
+#include "DMA_interface.h"
 #include "GPT_interface.h"
 #include "GPT_private.h"
 #include "GPT_config.h"
@@ -60,6 +64,39 @@ static void (*TIM1_CallBack)(void);
 static void (*TIM2_CallBack)(void);
 static void (*TIM3_CallBack)(void);
 static void (*TIM4_CallBack)(void);
+// Bit TIMx set: the callback of that timer is posted to the PendSV work queue
+static u8 GPT_DeferredTimers = 0;
+// Bit TIMx set: GPT_TIMx_SetBusyWait owns that timer, its update interrupt only wakes the core
+static volatile u8 GPT_BusyWaitTimers = 0;
+// Interrupt line raised by the update event of each timer
+static const IRQn_Type GPT_UpdateIRQn[4] = { NVIC_TIM1_UP_IRQn , NVIC_TIM2_IRQn , NVIC_TIM3_IRQn , NVIC_TIM4_IRQn };
+// DMA1 channel serving the update request of each timer
+static const u8 GPT_UpdateDMAChannel[4] = { DMA_REQ_TIM1_UP , DMA_REQ_TIM2_UP , DMA_REQ_TIM3_UP , DMA_REQ_TIM4_UP };
+// Bit TIMx set: the timer runs the encoder interface
+static u8 GPT_EncoderTimers = 0;
+// Encoder state, written by the timer interrupt: upper half of the position, last captured edge and its sequence number
+static volatile u16 GPT_EncoderWraps[TIM_IN_STM32F103C6];
+static volatile u32 GPT_EncoderEdgeTime[TIM_IN_STM32F103C6];
+static volatile s32 GPT_EncoderEdgePosition[TIM_IN_STM32F103C6];
+static volatile u8 GPT_EncoderEdgeSeq[TIM_IN_STM32F103C6];
+// Timer latching the edge times of each encoder, or TIM_ENCODER_NO_TIMESTAMP
+static u8 GPT_EncoderStampTimer[TIM_IN_STM32F103C6];
+// Velocity estimator state, owned by GPT_Encoder_GetVelocity
+static s32 GPT_EncoderRefPosition[TIM_IN_STM32F103C6];
+static u32 GPT_EncoderRefTime[TIM_IN_STM32F103C6];
+static u8 GPT_EncoderRefSeq[TIM_IN_STM32F103C6];
+static u8 GPT_EncoderRefIsEdge[TIM_IN_STM32F103C6];
+static s32 GPT_EncoderVelocity[TIM_IN_STM32F103C6];
+/**************************************** Static Functions Section *****************************************************/
+static void GPT_voidSetInputChannel(u8 Copy_TIMx , u8 Copy_Channel , u8 Copy_Selection , GPT_TIM_EDGE_t Copy_Edge , u8 Copy_Prescaler , u8 Copy_Filter);
+static u16 GPT_u16ReadCCR(u8 Copy_TIMx , u8 Copy_Channel);
+static s32 GPT_s32EncoderPosition(u8 Copy_TIMx);
+static void GPT_voidEncoderIRQ(u8 Copy_TIMx);
+static void GPT_voidEncoderStampInit(u8 Copy_Stamp , u8 Copy_TIMx);
+static void GPT_voidEncoderRestart(u8 Copy_TIMx , s32 Copy_Position , u32 Copy_Now);
+static u8 GPT_u8ChainIsValid(const GPT_Chain_t* Copy_Chain);
+static void GPT_voidSetChainSlave(u8 Copy_Slave , u8 Copy_Master);
+static Std_ReturnType GPT_DeadTimeToDTG(u32 Copy_DeadTimeNs , u8* Copy_DTG);
 /*====================================================   Start_FUNCTION   ====================================================*/
 Std_ReturnType GPT_TIMx_init(u8 Copy_TIMx,GPT_Config_t* Copy_GPT_Config)
 {
@@ -226,14 +263,36 @@ Std_ReturnType GPT_TIMx_SetInterrupt(u8 Copy_GPT_TIMx,GPT_INTState_t Copy_INTSta
 Std_ReturnType GPT_TIMx_SetBusyWait(u8 Copy_TIMx,u16 Copy_Ticks , u16 Copy_TickType)
 {
     Std_ReturnType local_functionStates = E_NOT_OK;
-    TIM[Copy_TIMx]->ARR = (u16)(Copy_Ticks * Copy_TickType);
-    CLR_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UIE);
-    SET_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN );
-    while(TIM[Copy_TIMx]->CNT != (TIM[Copy_TIMx]->ARR)-1);
-    TIM[Copy_TIMx]->CNT =0;
-    CLR_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN );
-    TIM[Copy_TIMx]->ARR = 0;
-    local_functionStates = E_OK;
+    u16 Local_Period = (u16)(Copy_Ticks * Copy_TickType);
+    if ( (Copy_TIMx <= TIM4) && (Local_Period != 0) )
+    {
+        SET_BIT( GPT_BusyWaitTimers , Copy_TIMx );
+        TIM[Copy_TIMx]->ARR = Local_Period;
+        TIM[Copy_TIMx]->CNT = 0;
+        /* One-pulse mode: the hardware clears CEN at the update, which the handler cannot hide as it does UIF */
+        SET_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_OPM );
+        CLR_BIT( TIM[Copy_TIMx]->SR , TIMX_SR_UIF );
+        /* SEVONPEND only signals a new pend: a pending bit left from an earlier update would keep WFE asleep */
+        MCAL_NVIC_ClearPendingIRQ(GPT_UpdateIRQn[Copy_TIMx]);
+        /* The update interrupt pends (even if disabled in the NVIC) and wakes MCAL_SCB_BlockingWait */
+        SET_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UIE);
+        SET_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN );
+        while (GET_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN ) == 1)
+        {
+            MCAL_SCB_BlockingWait();
+        }
+        CLR_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UIE);
+        CLR_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_OPM );
+        CLR_BIT( TIM[Copy_TIMx]->SR , TIMX_SR_UIF );
+        MCAL_NVIC_ClearPendingIRQ(GPT_UpdateIRQn[Copy_TIMx]);
+        TIM[Copy_TIMx]->CNT =0;
+        TIM[Copy_TIMx]->ARR = 0;
+        CLR_BIT( GPT_BusyWaitTimers , Copy_TIMx );
+        local_functionStates = E_OK;
+    }else
+    {
+        local_functionStates = E_NOT_OK;
+    }
     return local_functionStates;
 }
 /*====================================================   END_FUNCTION   ====================================================*/
@@ -335,66 +394,124 @@ Std_ReturnType GPT_TIMx_GetRemainingTime(u8 Copy_TIMx,GPT_CountDir_t Copy_CountD
 /*====================================================   Start_FUNCTION   ====================================================*/
 void TIM1_UP_IRQHandler (void)
 {
-    if(GPT_TIM1_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
-    {
-        CLR_BIT( TIM[0]->DIER , TIMX_DIER_UIE );
-        CLR_BIT( TIM[0]->CR1 , TIMX_CR1_CEN );
-        TIM[0]->ARR =0;
-    }else
+    NVIC_STATS_ENTER();
+    /* During a busy wait the update only wakes the core; the callback and interval mode are left alone */
+    if (GET_BIT(GPT_BusyWaitTimers , TIM1) == 0)
     {
+        if(GPT_TIM1_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
+        {
+            CLR_BIT( TIM[0]->DIER , TIMX_DIER_UIE );
+            CLR_BIT( TIM[0]->CR1 , TIMX_CR1_CEN );
+            TIM[0]->ARR =0;
+        }else
+        {
 
+        }
+        if (TIM1_CallBack != NULL)
+        {
+            if ( (GET_BIT(GPT_DeferredTimers , TIM1) == 0) || (MCAL_SCB_PostDeferredCallback(TIM1_CallBack) != E_OK) )
+            {
+                TIM1_CallBack();
+            }
+        }
     }
-    TIM1_CallBack();
     CLR_BIT(TIM[0]->SR,TIMX_SR_UIF);
+    NVIC_STATS_EXIT(NVIC_TIM1_UP_IRQn);
 
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void TIM2_UP_IRQHandler (void)
+/* TIM2..TIM4 have one global vector for update, capture/compare and trigger events */
+void TIM2_IRQHandler (void)
 {
-    if(GPT_TIM2_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
+    NVIC_STATS_ENTER();
+    /* An encoder timer only tracks counter wraps and edge timestamps */
+    if (GET_BIT(GPT_EncoderTimers , TIM2) == 1)
     {
-        CLR_BIT( TIM[1]->DIER , TIMX_DIER_UIE );
-        CLR_BIT( TIM[1]->CR1 , TIMX_CR1_CEN );
-        TIM[1]->ARR =0;
-    }else
+        GPT_voidEncoderIRQ(TIM2);
+    }else if (GET_BIT(GPT_BusyWaitTimers , TIM2) == 0)
     {
+        if(GPT_TIM2_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
+        {
+            CLR_BIT( TIM[1]->DIER , TIMX_DIER_UIE );
+            CLR_BIT( TIM[1]->CR1 , TIMX_CR1_CEN );
+            TIM[1]->ARR =0;
+        }else
+        {
 
+        }
+        if (TIM2_CallBack != NULL)
+        {
+            if ( (GET_BIT(GPT_DeferredTimers , TIM2) == 0) || (MCAL_SCB_PostDeferredCallback(TIM2_CallBack) != E_OK) )
+            {
+                TIM2_CallBack();
+            }
+        }
     }
-    TIM2_CallBack();
     CLR_BIT(TIM[1]->SR,TIMX_SR_UIF);
+    NVIC_STATS_EXIT(NVIC_TIM2_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void TIM3_UP_IRQHandler (void)
+void TIM3_IRQHandler (void)
 {
-    if(GPT_TIM3_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
+    NVIC_STATS_ENTER();
+    /* An encoder timer only tracks counter wraps and edge timestamps */
+    if (GET_BIT(GPT_EncoderTimers , TIM3) == 1)
     {
-        CLR_BIT( TIM[2]->DIER , TIMX_DIER_UIE );
-        CLR_BIT( TIM[2]->CR1 , TIMX_CR1_CEN );
-        TIM[2]->ARR =0;
-    }else
+        GPT_voidEncoderIRQ(TIM3);
+    }else if (GET_BIT(GPT_BusyWaitTimers , TIM3) == 0)
     {
+        if(GPT_TIM3_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
+        {
+            CLR_BIT( TIM[2]->DIER , TIMX_DIER_UIE );
+            CLR_BIT( TIM[2]->CR1 , TIMX_CR1_CEN );
+            TIM[2]->ARR =0;
+        }else
+        {
 
+        }
+        if (TIM3_CallBack != NULL)
+        {
+            if ( (GET_BIT(GPT_DeferredTimers , TIM3) == 0) || (MCAL_SCB_PostDeferredCallback(TIM3_CallBack) != E_OK) )
+            {
+                TIM3_CallBack();
+            }
+        }
     }
-    TIM3_CallBack();
     CLR_BIT(TIM[2]->SR,TIMX_SR_UIF);
+    NVIC_STATS_EXIT(NVIC_TIM3_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
-void TIM4_UP_IRQHandler (void)
+void TIM4_IRQHandler (void)
 {
-    if(GPT_TIM4_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
+    NVIC_STATS_ENTER();
+    /* An encoder timer only tracks counter wraps and edge timestamps */
+    if (GET_BIT(GPT_EncoderTimers , TIM4) == 1)
     {
-        CLR_BIT( TIM[3]->DIER , TIMX_DIER_UIE );
-        CLR_BIT( TIM[3]->CR1 , TIMX_CR1_CEN );
-        TIM[3]->ARR =0;
-    }else
+        GPT_voidEncoderIRQ(TIM4);
+    }else if (GET_BIT(GPT_BusyWaitTimers , TIM4) == 0)
     {
+        if(GPT_TIM4_GetIntervalMode() == TIM_SINGLE_INTERVAL_MODE)
+        {
+            CLR_BIT( TIM[3]->DIER , TIMX_DIER_UIE );
+            CLR_BIT( TIM[3]->CR1 , TIMX_CR1_CEN );
+            TIM[3]->ARR =0;
+        }else
+        {
 
+        }
+        if (TIM4_CallBack != NULL)
+        {
+            if ( (GET_BIT(GPT_DeferredTimers , TIM4) == 0) || (MCAL_SCB_PostDeferredCallback(TIM4_CallBack) != E_OK) )
+            {
+                TIM4_CallBack();
+            }
+        }
     }
-    TIM4_CallBack();
     CLR_BIT(TIM[3]->SR,TIMX_SR_UIF);
+    NVIC_STATS_EXIT(NVIC_TIM4_IRQn);
 }
 /*====================================================   END_FUNCTION   ====================================================*/
 /*====================================================   Start_FUNCTION   ====================================================*/
@@ -551,4 +668,772 @@ Std_ReturnType GPT_PWM_GetCounterValue(u8 Copy_TIMx,u16* Copy_PWMValue)
     local_functionStates = E_OK;
     return local_functionStates;
 }
-/*====================================================   END_FUNCTION   ====================================================*/
\ No newline at end of file
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_TIMx_SetUpdateDMA(u8 Copy_TIMx , u16 Copy_Prescalar , u16 Copy_Period)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (Copy_TIMx < TIM_IN_STM32F103C6)
+    {
+        CLR_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN );
+        CLR_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UDE );
+        TIM[Copy_TIMx]->PSC = Copy_Prescalar;
+        TIM[Copy_TIMx]->ARR = Copy_Period;
+        /* Load PSC now; UDE is still clear so this update does not request a transfer */
+        SET_BIT( TIM[Copy_TIMx]->EGR , TIMX_EGR_UG );
+        CLR_BIT( TIM[Copy_TIMx]->SR , TIMX_SR_UIF );
+        SET_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UDE );
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_TIMx_ClearUpdateDMA(u8 Copy_TIMx)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (Copy_TIMx < TIM_IN_STM32F103C6)
+    {
+        CLR_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN );
+        CLR_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UDE );
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_TIMx_SetCallbackMode(u8 Copy_TIMx , u8 Copy_Mode)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (Copy_Mode == TIM_CALLBACK_IMMEDIATE) )
+    {
+        CLR_BIT( GPT_DeferredTimers , Copy_TIMx );
+        local_functionStates = E_OK;
+    }else if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (Copy_Mode == TIM_CALLBACK_DEFERRED) )
+    {
+        SET_BIT( GPT_DeferredTimers , Copy_TIMx );
+        local_functionStates = E_OK;
+    }else
+    {
+        local_functionStates = E_NOT_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_PWM_StartBurst(u8 Copy_TIMx , const u16* Copy_Table , u16 Copy_Records , u8 Copy_Layout , u8 Copy_Repeat , void (*Copy_DoneFunc)(void))
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    DMA_ChannelConfig_t Local_Config;
+    u32 Local_Words = (Copy_Layout == TIM_BURST_ARR_CCR) ? TIM_BURST_ARR_CCR_WORDS : TIM_BURST_CCR_WORDS;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (Copy_Table != NULL) && (Copy_Records != 0)
+      && ((Copy_Layout == TIM_BURST_CCR) || ((Copy_Layout == TIM_BURST_ARR_CCR) && (Copy_TIMx == TIM1)))
+      && ((Copy_Repeat == TIM_BURST_ONE_SHOT) || (Copy_Repeat == TIM_BURST_CIRCULAR))
+      && (((u32)Copy_Records * Local_Words) <= 0xFFFF) )
+    {
+        CLR_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UDE );
+        MCAL_DMA_StopChannel(GPT_UpdateDMAChannel[Copy_TIMx]);
+        if (Copy_Layout == TIM_BURST_ARR_CCR)
+        {
+            TIM[Copy_TIMx]->DCR = (u16)( ((Local_Words - 1) << TIMX_DCR_DBL) | (GPT_BURST_DBA_ARR << TIMX_DCR_DBA) );
+            SET_BIT( TIM[Copy_TIMx]->CR1 , TIMx_CR1_ARPE );
+        }else
+        {
+            TIM[Copy_TIMx]->DCR = (u16)( ((Local_Words - 1) << TIMX_DCR_DBL) | (GPT_BURST_DBA_CCR1 << TIMX_DCR_DBA) );
+        }
+        /* Every DMAR access is forwarded to the next register of the burst */
+        Local_Config.PeripheralAddress = (u32)&(TIM[Copy_TIMx]->DMAR);
+        Local_Config.MemoryAddress = (u32)Copy_Table;
+        Local_Config.Count = (u16)((u32)Copy_Records * Local_Words);
+        Local_Config.Direction = DMA_DIR_MEM_TO_PERIPH;
+        Local_Config.PeripheralSize = DMA_SIZE_16BIT;
+        Local_Config.MemorySize = DMA_SIZE_16BIT;
+        Local_Config.PeripheralInc = DMA_INC_DISABLE;
+        Local_Config.MemoryInc = DMA_INC_ENABLE;
+        Local_Config.Mode = (Copy_Repeat == TIM_BURST_CIRCULAR) ? DMA_MODE_CIRCULAR : DMA_MODE_NORMAL;
+        Local_Config.Priority = DMA_PRIORITY_HIGH;
+        Local_Config.Interrupts = (Copy_DoneFunc != NULL) ? DMA_INT_TRANSFER_COMPLETE : DMA_INT_NONE;
+        local_functionStates = MCAL_DMA_SetCallback(GPT_UpdateDMAChannel[Copy_TIMx] , DMA_EVENT_TRANSFER_COMPLETE , Copy_DoneFunc);
+        if (local_functionStates == E_OK)
+        {
+            local_functionStates = MCAL_DMA_InitChannel(GPT_UpdateDMAChannel[Copy_TIMx] , &Local_Config);
+        }
+        if (local_functionStates == E_OK)
+        {
+            local_functionStates = MCAL_DMA_StartChannel(GPT_UpdateDMAChannel[Copy_TIMx]);
+        }
+        /* No update requests unless the channel is armed */
+        if (local_functionStates == E_OK)
+        {
+            SET_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UDE );
+        }
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_PWM_StopBurst(u8 Copy_TIMx)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (Copy_TIMx < TIM_IN_STM32F103C6)
+    {
+        CLR_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UDE );
+        MCAL_DMA_StopChannel(GPT_UpdateDMAChannel[Copy_TIMx]);
+        TIM[Copy_TIMx]->DCR = 0;
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_IC_INIT(u8 Copy_TIMx , GPT_IC_Config_t* Copy_IC_Config)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (Copy_IC_Config != NULL) && (Copy_IC_Config->Channel <= TIM_Channel4)
+      && (Copy_IC_Config->Selection >= TIM_IC_DIRECT) && (Copy_IC_Config->Selection <= TIM_IC_TRC)
+      && (Copy_IC_Config->Prescaler <= TIM_IC_EVERY_8_EDGES) && (Copy_IC_Config->Filter <= TIMX_CCMR_ICF_MAX) )
+    {
+        GPT_voidSetInputChannel(Copy_TIMx , Copy_IC_Config->Channel , Copy_IC_Config->Selection , Copy_IC_Config->Edge ,
+                                Copy_IC_Config->Prescaler , Copy_IC_Config->Filter);
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_IC_Read(u8 Copy_TIMx , GPT_PWM_Channel_t Copy_Channel , u16* Copy_Capture , u8* Copy_Missed)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (Copy_Channel <= TIM_Channel4) && (Copy_Capture != NULL) )
+    {
+        if (GET_BIT( TIM[Copy_TIMx]->SR , (TIMX_SR_CC1IF + Copy_Channel) ) == 1)
+        {
+            /* Reading CCRx clears CCxIF */
+            *Copy_Capture = GPT_u16ReadCCR(Copy_TIMx , Copy_Channel);
+            if (Copy_Missed != NULL)
+            {
+                *Copy_Missed = (u8)GET_BIT( TIM[Copy_TIMx]->SR , (TIMX_SR_CC1OF + Copy_Channel) );
+            }
+            /* SR bits are rc_w0: writing 1 to the others leaves them untouched */
+            TIM[Copy_TIMx]->SR = (u16)~(1 << (TIMX_SR_CC1OF + Copy_Channel));
+            local_functionStates = E_OK;
+        }
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_IC_PWMInput_INIT(u8 Copy_TIMx , GPT_TIM_EDGE_t Copy_Edge , u8 Copy_Filter)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (Copy_Filter <= TIMX_CCMR_ICF_MAX) && ((Copy_Edge == Rising) || (Copy_Edge == Falling)) )
+    {
+        /* CH1: TI1 on the period edge, CH2: TI1 on the other edge */
+        GPT_voidSetInputChannel(Copy_TIMx , TIM_Channel1 , TIM_IC_DIRECT , Copy_Edge , TIM_IC_EVERY_EDGE , Copy_Filter);
+        GPT_voidSetInputChannel(Copy_TIMx , TIM_Channel2 , TIM_IC_INDIRECT , (Copy_Edge == Rising) ? Falling : Rising ,
+                                TIM_IC_EVERY_EDGE , Copy_Filter);
+        /* Slave reset mode triggered by TI1FP1: the period edge captures CCR1, then clears the counter */
+        TIM[Copy_TIMx]->SMCR = (u16)( (TIM[Copy_TIMx]->SMCR & ~(TIMX_SMCR_SMS_MASK | TIMX_SMCR_TS_MASK))
+                                    | (TIMX_SMCR_TS_TI1FP1 << TIMX_SMCR_TS) | (TIMX_SMCR_SMS_RESET << TIMX_SMCR_SMS) );
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_IC_PWMInput_Read(u8 Copy_TIMx , u16* Copy_Period , u16* Copy_Pulse)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (Copy_Period != NULL) && (Copy_Pulse != NULL) )
+    {
+        if (GET_BIT( TIM[Copy_TIMx]->SR , TIMX_SR_CC1IF ) == 1)
+        {
+            /* CCR2 first: it was latched within the period that CCR1 closes */
+            *Copy_Pulse = TIM[Copy_TIMx]->CCR2;
+            *Copy_Period = TIM[Copy_TIMx]->CCR1;
+            local_functionStates = E_OK;
+        }
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void GPT_voidSetInputChannel(u8 Copy_TIMx , u8 Copy_Channel , u8 Copy_Selection , GPT_TIM_EDGE_t Copy_Edge , u8 Copy_Prescaler , u8 Copy_Filter)
+{
+    u8 Local_Shift = (u8)((Copy_Channel & 1) * 8);
+    u16 Local_Field = (u16)( (Copy_Selection << TIMX_CCMR_CCS) | (Copy_Prescaler << TIMX_CCMR_ICPSC) | (Copy_Filter << TIMX_CCMR_ICF) );
+    /* CCxS can only be written while the channel is off (CCxE = 0) */
+    CLR_BIT( TIM[Copy_TIMx]->CCER , (TIMX_CCER_CC1E + (Copy_Channel * 4)) );
+    if (Copy_Channel <= TIM_Channel2)
+    {
+        TIM[Copy_TIMx]->CCMR1 = (u16)( (TIM[Copy_TIMx]->CCMR1 & ~(TIMX_CCMR_CH_MASK << Local_Shift)) | (Local_Field << Local_Shift) );
+    }else
+    {
+        TIM[Copy_TIMx]->CCMR2 = (u16)( (TIM[Copy_TIMx]->CCMR2 & ~(TIMX_CCMR_CH_MASK << Local_Shift)) | (Local_Field << Local_Shift) );
+    }
+    if (Copy_Edge == Falling)
+    {
+        SET_BIT( TIM[Copy_TIMx]->CCER , (TIMX_CCER_CC1P + (Copy_Channel * 4)) );
+    }else
+    {
+        CLR_BIT( TIM[Copy_TIMx]->CCER , (TIMX_CCER_CC1P + (Copy_Channel * 4)) );
+    }
+    TIM[Copy_TIMx]->SR = (u16)~( (1 << (TIMX_SR_CC1IF + Copy_Channel)) | (1 << (TIMX_SR_CC1OF + Copy_Channel)) );
+    SET_BIT( TIM[Copy_TIMx]->CCER , (TIMX_CCER_CC1E + (Copy_Channel * 4)) );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static u16 GPT_u16ReadCCR(u8 Copy_TIMx , u8 Copy_Channel)
+{
+    u16 Local_Value;
+    switch (Copy_Channel)
+    {
+    case TIM_Channel1:
+        Local_Value = TIM[Copy_TIMx]->CCR1;
+        break;
+    case TIM_Channel2:
+        Local_Value = TIM[Copy_TIMx]->CCR2;
+        break;
+    case TIM_Channel3:
+        Local_Value = TIM[Copy_TIMx]->CCR3;
+        break;
+    default:
+        Local_Value = TIM[Copy_TIMx]->CCR4;
+        break;
+    }
+    return Local_Value;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Encoder_INIT(u8 Copy_TIMx , GPT_Encoder_Config_t* Copy_Encoder_Config)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if ( (Copy_TIMx >= TIM2) && (Copy_TIMx <= TIM4) && (Copy_Encoder_Config != NULL)
+      && (Copy_Encoder_Config->Mode >= TIM_ENCODER_X2_TI2) && (Copy_Encoder_Config->Mode <= TIM_ENCODER_X4)
+      && (Copy_Encoder_Config->Filter <= TIMX_CCMR_ICF_MAX)
+      && ( (Copy_Encoder_Config->TimestampTIMx == TIM_ENCODER_NO_TIMESTAMP)
+        || ( (Copy_Encoder_Config->TimestampTIMx < TIM_IN_STM32F103C6) && (Copy_Encoder_Config->TimestampTIMx != Copy_TIMx)
+          && (GET_BIT(GPT_EncoderTimers , Copy_Encoder_Config->TimestampTIMx) == 0) ) ) )
+    {
+        /* Sampling times of the velocity estimator */
+        MCAL_SCB_StartCycleCounter();
+        CLR_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN );
+        TIM[Copy_TIMx]->DIER &= (u16)~GPT_ENCODER_DIER_MASK;
+        TIM[Copy_TIMx]->SMCR &= (u16)~(TIMX_SMCR_SMS_MASK | TIMX_SMCR_TS_MASK);
+        /* IC1 = TI1, IC2 = TI2: the channels capture (only used as edge events) and set the input polarities */
+        GPT_voidSetInputChannel(Copy_TIMx , TIM_Channel1 , TIM_IC_DIRECT , Copy_Encoder_Config->TI1Polarity ,
+                                TIM_IC_EVERY_EDGE , Copy_Encoder_Config->Filter);
+        GPT_voidSetInputChannel(Copy_TIMx , TIM_Channel2 , TIM_IC_DIRECT , Copy_Encoder_Config->TI2Polarity ,
+                                TIM_IC_EVERY_EDGE , Copy_Encoder_Config->Filter);
+        TIM[Copy_TIMx]->SMCR |= (u16)(Copy_Encoder_Config->Mode << TIMX_SMCR_SMS);
+        TIM[Copy_TIMx]->PSC = 0;
+        TIM[Copy_TIMx]->ARR = 0xFFFF;
+        /* Load PSC and clear CNT; the update flag it raises is not a wrap */
+        SET_BIT( TIM[Copy_TIMx]->EGR , TIMX_EGR_UG );
+        TIM[Copy_TIMx]->SR = 0;
+        GPT_EncoderStampTimer[Copy_TIMx] = Copy_Encoder_Config->TimestampTIMx;
+        if (Copy_Encoder_Config->TimestampTIMx != TIM_ENCODER_NO_TIMESTAMP)
+        {
+            /* Each TI1 capture pulses TRGO, which the timestamp timer captures on TRC */
+            TIM[Copy_TIMx]->CR2 = (u16)( (TIM[Copy_TIMx]->CR2 & ~TIMX_CR2_MMS_MASK) | (TIMX_CR2_MMS_CC1 << TIMX_CR2_MMS) );
+            GPT_voidEncoderStampInit(Copy_Encoder_Config->TimestampTIMx , Copy_TIMx);
+        }
+        GPT_EncoderWraps[Copy_TIMx] = 0;
+        GPT_EncoderVelocity[Copy_TIMx] = 0;
+        GPT_voidEncoderRestart(Copy_TIMx , 0 , SCB_DWT_CYCCNT);
+        SET_BIT( GPT_EncoderTimers , Copy_TIMx );
+        SET_BIT( TIM[Copy_TIMx]->DIER , TIMX_DIER_UIE );
+        SET_BIT( TIM[Copy_TIMx]->CR1 , TIMX_CR1_CEN );
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Encoder_GetPosition(u8 Copy_TIMx , s32* Copy_Position)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (GET_BIT(GPT_EncoderTimers , Copy_TIMx) == 1) && (Copy_Position != NULL) )
+    {
+        *Copy_Position = GPT_s32EncoderPosition(Copy_TIMx);
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Encoder_SetPosition(u8 Copy_TIMx , s32 Copy_Position)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    u8 Local_SavedState;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (GET_BIT(GPT_EncoderTimers , Copy_TIMx) == 1) )
+    {
+        MCAL_SCB_EnterCritical(&Local_SavedState);
+        /* A wrap pending from the old count must not be applied to the new one */
+        TIM[Copy_TIMx]->SR = (u16)~(1 << TIMX_SR_UIF);
+        TIM[Copy_TIMx]->CNT = (u16)Copy_Position;
+        GPT_EncoderWraps[Copy_TIMx] = (u16)((u32)Copy_Position >> 16);
+        GPT_voidEncoderRestart(Copy_TIMx , Copy_Position , SCB_DWT_CYCCNT);
+        MCAL_SCB_ExitCritical(Local_SavedState);
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Encoder_GetVelocity(u8 Copy_TIMx , s32* Copy_Velocity)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    u32 Local_Now;
+    s32 Local_Position;
+    s32 Local_Delta;
+    u32 Local_Elapsed;
+    u8 Local_Seq;
+    u32 Local_EdgeTime;
+    s32 Local_EdgePosition;
+    s32 Local_Limit;
+    if ( (Copy_TIMx < TIM_IN_STM32F103C6) && (GET_BIT(GPT_EncoderTimers , Copy_TIMx) == 1) && (Copy_Velocity != NULL) )
+    {
+        Local_Now = SCB_DWT_CYCCNT;
+        Local_Position = GPT_s32EncoderPosition(Copy_TIMx);
+        Local_Delta = Local_Position - GPT_EncoderRefPosition[Copy_TIMx];
+        if ( (Local_Delta >= GPT_ENCODER_LOW_SPEED_COUNTS) || (Local_Delta <= -GPT_ENCODER_LOW_SPEED_COUNTS) )
+        {
+            /* M method: counts over the sampling time; no edge interrupts at speed */
+            Local_Elapsed = Local_Now - GPT_EncoderRefTime[Copy_TIMx];
+            if (Local_Elapsed != 0)
+            {
+                GPT_EncoderVelocity[Copy_TIMx] = (s32)( ((s64)Local_Delta * SYSTEM_CLOCK_FREQUENCY) / (s64)Local_Elapsed );
+            }
+            TIM[Copy_TIMx]->DIER &= (u16)~GPT_ENCODER_EDGE_IE;
+            GPT_voidEncoderRestart(Copy_TIMx , Local_Position , Local_Now);
+        }else
+        {
+            /* T method: counts over the time between two captured edges */
+            if ( (GPT_EncoderStampTimer[Copy_TIMx] != TIM_ENCODER_NO_TIMESTAMP)
+              && ((TIM[Copy_TIMx]->DIER & GPT_ENCODER_EDGE_IE) == 0) )
+            {
+                GPT_EncoderRefSeq[Copy_TIMx] = GPT_EncoderEdgeSeq[Copy_TIMx];
+                TIM[Copy_TIMx]->SR = (u16)~GPT_ENCODER_CC1_FLAGS;
+                TIM[Copy_TIMx]->DIER |= GPT_ENCODER_EDGE_IE;
+            }
+            do
+            {
+                Local_Seq = GPT_EncoderEdgeSeq[Copy_TIMx];
+                Local_EdgeTime = GPT_EncoderEdgeTime[Copy_TIMx];
+                Local_EdgePosition = GPT_EncoderEdgePosition[Copy_TIMx];
+            } while (Local_Seq != GPT_EncoderEdgeSeq[Copy_TIMx]);
+            if (Local_Seq != GPT_EncoderRefSeq[Copy_TIMx])
+            {
+                Local_Elapsed = Local_EdgeTime - GPT_EncoderRefTime[Copy_TIMx];
+                /* The first edge after a sample-time reference only starts the edge-to-edge measurement */
+                if ( (GPT_EncoderRefIsEdge[Copy_TIMx] == 1) && (Local_Elapsed != 0) )
+                {
+                    GPT_EncoderVelocity[Copy_TIMx] = (s32)( ((s64)(Local_EdgePosition - GPT_EncoderRefPosition[Copy_TIMx])
+                                                             * SYSTEM_CLOCK_FREQUENCY) / (s64)Local_Elapsed );
+                }
+                GPT_EncoderRefPosition[Copy_TIMx] = Local_EdgePosition;
+                GPT_EncoderRefTime[Copy_TIMx] = Local_EdgeTime;
+                GPT_EncoderRefSeq[Copy_TIMx] = Local_Seq;
+                GPT_EncoderRefIsEdge[Copy_TIMx] = 1;
+            }else
+            {
+                Local_Elapsed = Local_Now - GPT_EncoderRefTime[Copy_TIMx];
+                if (Local_Elapsed >= GPT_ENCODER_STOP_CYCLES)
+                {
+                    GPT_EncoderVelocity[Copy_TIMx] = 0;
+                    GPT_voidEncoderRestart(Copy_TIMx , Local_Position , Local_Now);
+                }else if (Local_Elapsed != 0)
+                {
+                    /* No edge for Local_Elapsed: the speed is below one count over that time */
+                    Local_Limit = (s32)(SYSTEM_CLOCK_FREQUENCY / Local_Elapsed);
+                    if (GPT_EncoderVelocity[Copy_TIMx] > Local_Limit)
+                    {
+                        GPT_EncoderVelocity[Copy_TIMx] = Local_Limit;
+                    }else if (GPT_EncoderVelocity[Copy_TIMx] < -Local_Limit)
+                    {
+                        GPT_EncoderVelocity[Copy_TIMx] = -Local_Limit;
+                    }else
+                    {
+
+                    }
+                }else
+                {
+
+                }
+            }
+        }
+        *Copy_Velocity = GPT_EncoderVelocity[Copy_TIMx];
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static s32 GPT_s32EncoderPosition(u8 Copy_TIMx)
+{
+    u16 Local_Wraps;
+    u16 Local_Status;
+    u16 Local_Count;
+    /* Retry if the interrupt counted a wrap, or the counter wrapped, during the reads */
+    do
+    {
+        Local_Wraps = GPT_EncoderWraps[Copy_TIMx];
+        Local_Status = TIM[Copy_TIMx]->SR;
+        Local_Count = TIM[Copy_TIMx]->CNT;
+    } while ( (Local_Wraps != GPT_EncoderWraps[Copy_TIMx])
+           || (GET_BIT(Local_Status , TIMX_SR_UIF) != GET_BIT(TIM[Copy_TIMx]->SR , TIMX_SR_UIF)) );
+    /* A wrap the interrupt has not counted yet (masked, or preempted by the caller) */
+    if (GET_BIT(Local_Status , TIMX_SR_UIF) == 1)
+    {
+        if (Local_Count < GPT_ENCODER_HALF_RANGE)
+        {
+            Local_Wraps++;
+        }else
+        {
+            Local_Wraps--;
+        }
+    }
+    return (s32)( ((u32)Local_Wraps << 16) | Local_Count );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void GPT_voidEncoderIRQ(u8 Copy_TIMx)
+{
+    u8 Local_Stamp = GPT_EncoderStampTimer[Copy_TIMx];
+    u16 Local_EdgeCount;
+    u16 Local_EdgeTicks;
+    u32 Local_Now;
+    u16 Local_NowTicks;
+    s32 Local_Position;
+    if (GET_BIT(TIM[Copy_TIMx]->SR , TIMX_SR_UIF) == 1)
+    {
+        /* Clear the flag before counting the wrap, so a reader never sees both (see GPT_s32EncoderPosition) */
+        TIM[Copy_TIMx]->SR = (u16)~(1 << TIMX_SR_UIF);
+        if (TIM[Copy_TIMx]->CNT < GPT_ENCODER_HALF_RANGE)
+        {
+            GPT_EncoderWraps[Copy_TIMx]++;
+        }else
+        {
+            GPT_EncoderWraps[Copy_TIMx]--;
+        }
+    }
+    if ( (TIM[Copy_TIMx]->SR & TIM[Copy_TIMx]->DIER & GPT_ENCODER_EDGE_IE) != 0 )
+    {
+        /* Counter and time latched by the hardware at the edge; the interrupt latency only sets their age */
+        Local_EdgeCount = TIM[Copy_TIMx]->CCR1;
+        Local_EdgeTicks = TIM[Local_Stamp]->CCR1;
+        Local_Now = SCB_DWT_CYCCNT;
+        Local_NowTicks = TIM[Local_Stamp]->CNT;
+        TIM[Copy_TIMx]->SR = (u16)~GPT_ENCODER_CC1_FLAGS;
+        TIM[Local_Stamp]->SR = (u16)~GPT_ENCODER_CC1_FLAGS;
+        Local_Position = GPT_s32EncoderPosition(Copy_TIMx);
+        GPT_EncoderEdgeTime[Copy_TIMx] = Local_Now - ((u32)(u16)(Local_NowTicks - Local_EdgeTicks) * GPT_ENCODER_CYCLES_PER_TICK);
+        GPT_EncoderEdgePosition[Copy_TIMx] = Local_Position - (s16)((u16)Local_Position - Local_EdgeCount);
+        GPT_EncoderEdgeSeq[Copy_TIMx]++;
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void GPT_voidEncoderStampInit(u8 Copy_Stamp , u8 Copy_TIMx)
+{
+    CLR_BIT( TIM[Copy_Stamp]->CR1 , TIMX_CR1_CEN );
+    TIM[Copy_Stamp]->DIER = 0;
+    /* Trigger = TRGO of the encoder timer, slave mode off: the trigger only feeds TRC */
+    TIM[Copy_Stamp]->SMCR &= (u16)~TIMX_SMCR_SMS_MASK;
+    TIM[Copy_Stamp]->SMCR = (u16)( (TIM[Copy_Stamp]->SMCR & ~TIMX_SMCR_TS_MASK) | (GPT_CHAIN_ITR(Copy_TIMx) << TIMX_SMCR_TS) );
+    GPT_voidSetInputChannel(Copy_Stamp , TIM_Channel1 , TIM_IC_TRC , Rising , TIM_IC_EVERY_EDGE , 0);
+    TIM[Copy_Stamp]->PSC = 0;
+    TIM[Copy_Stamp]->ARR = 0xFFFF;
+    SET_BIT( TIM[Copy_Stamp]->EGR , TIMX_EGR_UG );
+    TIM[Copy_Stamp]->SR = 0;
+    SET_BIT( TIM[Copy_Stamp]->CR1 , TIMX_CR1_CEN );
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void GPT_voidEncoderRestart(u8 Copy_TIMx , s32 Copy_Position , u32 Copy_Now)
+{
+    GPT_EncoderRefPosition[Copy_TIMx] = Copy_Position;
+    GPT_EncoderRefTime[Copy_TIMx] = Copy_Now;
+    GPT_EncoderRefSeq[Copy_TIMx] = GPT_EncoderEdgeSeq[Copy_TIMx];
+    GPT_EncoderRefIsEdge[Copy_TIMx] = 0;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Chain_INIT(const GPT_Chain_t* Copy_Chain , u16 Copy_Prescalar)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (GPT_u8ChainIsValid(Copy_Chain) == 1)
+    {
+        GPT_Chain_Stop(Copy_Chain);
+        TIM[Copy_Chain->Low]->SMCR &= (u16)~(TIMX_SMCR_SMS_MASK | TIMX_SMCR_TS_MASK);
+        TIM[Copy_Chain->Low]->CR2 = (u16)( (TIM[Copy_Chain->Low]->CR2 & ~TIMX_CR2_MMS_MASK) | (TIMX_CR2_MMS_UPDATE << TIMX_CR2_MMS) );
+        TIM[Copy_Chain->Low]->PSC = Copy_Prescalar;
+        TIM[Copy_Chain->Low]->ARR = 0xFFFF;
+        GPT_voidSetChainSlave(Copy_Chain->Mid , Copy_Chain->Low);
+        if (Copy_Chain->High != TIM_CHAIN_NONE)
+        {
+            TIM[Copy_Chain->Mid]->CR2 = (u16)( (TIM[Copy_Chain->Mid]->CR2 & ~TIMX_CR2_MMS_MASK) | (TIMX_CR2_MMS_UPDATE << TIMX_CR2_MMS) );
+            GPT_voidSetChainSlave(Copy_Chain->High , Copy_Chain->Mid);
+        }
+        /* Load PSC and clear CNT from the bottom up: a stopped slave ignores the update its master sends on UG */
+        SET_BIT( TIM[Copy_Chain->Low]->EGR , TIMX_EGR_UG );
+        TIM[Copy_Chain->Low]->SR = 0;
+        SET_BIT( TIM[Copy_Chain->Mid]->EGR , TIMX_EGR_UG );
+        TIM[Copy_Chain->Mid]->SR = 0;
+        if (Copy_Chain->High != TIM_CHAIN_NONE)
+        {
+            SET_BIT( TIM[Copy_Chain->High]->EGR , TIMX_EGR_UG );
+            TIM[Copy_Chain->High]->SR = 0;
+        }
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Chain_Start(const GPT_Chain_t* Copy_Chain)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (GPT_u8ChainIsValid(Copy_Chain) == 1)
+    {
+        if (Copy_Chain->High != TIM_CHAIN_NONE)
+        {
+            SET_BIT( TIM[Copy_Chain->High]->CR1 , TIMX_CR1_CEN );
+        }
+        SET_BIT( TIM[Copy_Chain->Mid]->CR1 , TIMX_CR1_CEN );
+        SET_BIT( TIM[Copy_Chain->Low]->CR1 , TIMX_CR1_CEN );
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Chain_Stop(const GPT_Chain_t* Copy_Chain)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (GPT_u8ChainIsValid(Copy_Chain) == 1)
+    {
+        CLR_BIT( TIM[Copy_Chain->Low]->CR1 , TIMX_CR1_CEN );
+        CLR_BIT( TIM[Copy_Chain->Mid]->CR1 , TIMX_CR1_CEN );
+        if (Copy_Chain->High != TIM_CHAIN_NONE)
+        {
+            CLR_BIT( TIM[Copy_Chain->High]->CR1 , TIMX_CR1_CEN );
+        }
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_Chain_Read(const GPT_Chain_t* Copy_Chain , u64* Copy_Count)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    u16 Local_High = 0;
+    u16 Local_Mid;
+    u16 Local_Low;
+    u16 Local_HighCheck = 0;
+    u16 Local_MidCheck;
+    if ( (GPT_u8ChainIsValid(Copy_Chain) == 1) && (Copy_Count != NULL) )
+    {
+        do
+        {
+            if (Copy_Chain->High != TIM_CHAIN_NONE)
+            {
+                Local_High = TIM[Copy_Chain->High]->CNT;
+            }
+            Local_Mid = TIM[Copy_Chain->Mid]->CNT;
+            Local_Low = TIM[Copy_Chain->Low]->CNT;
+            Local_MidCheck = TIM[Copy_Chain->Mid]->CNT;
+            if (Copy_Chain->High != TIM_CHAIN_NONE)
+            {
+                Local_HighCheck = TIM[Copy_Chain->High]->CNT;
+            }
+        } while ( (Local_Mid != Local_MidCheck) || (Local_High != Local_HighCheck) );
+        /* Just after a wrap the carry may still be in the slave's resync stage: read the upper stages once more, later */
+        if (Local_Low < GPT_CHAIN_SYNC_TICKS)
+        {
+            (void)TIM[Copy_Chain->Low]->CNT;
+            Local_Mid = TIM[Copy_Chain->Mid]->CNT;
+            if (Copy_Chain->High != TIM_CHAIN_NONE)
+            {
+                /* A Mid that has just wrapped sends its own carry on through another resync stage: wait for it too */
+                if (Local_Mid == 0)
+                {
+                    (void)TIM[Copy_Chain->Low]->CNT;
+                }
+                Local_High = TIM[Copy_Chain->High]->CNT;
+            }
+        }
+        *Copy_Count = ((u64)Local_High << 32) | ((u32)Local_Mid << 16) | Local_Low;
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static u8 GPT_u8ChainIsValid(const GPT_Chain_t* Copy_Chain)
+{
+    u8 Local_IsValid = 0;
+    if ( (Copy_Chain != NULL) && (Copy_Chain->Low < TIM_IN_STM32F103C6) && (Copy_Chain->Mid < TIM_IN_STM32F103C6)
+      && (Copy_Chain->Low != Copy_Chain->Mid) )
+    {
+        if (Copy_Chain->High == TIM_CHAIN_NONE)
+        {
+            Local_IsValid = 1;
+        }else if ( (Copy_Chain->High < TIM_IN_STM32F103C6) && (Copy_Chain->High != Copy_Chain->Low)
+                && (Copy_Chain->High != Copy_Chain->Mid) )
+        {
+            Local_IsValid = 1;
+        }else
+        {
+
+        }
+    }
+    return Local_IsValid;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void GPT_voidSetChainSlave(u8 Copy_Slave , u8 Copy_Master)
+{
+    TIM[Copy_Slave]->PSC = 0;
+    TIM[Copy_Slave]->ARR = 0xFFFF;
+    /* TS must only change while the slave mode is off (SMS = 000), or the old trigger may clock the counter once */
+    TIM[Copy_Slave]->SMCR &= (u16)~TIMX_SMCR_SMS_MASK;
+    TIM[Copy_Slave]->SMCR = (u16)( (TIM[Copy_Slave]->SMCR & ~TIMX_SMCR_TS_MASK) | (GPT_CHAIN_ITR(Copy_Master) << TIMX_SMCR_TS) );
+    TIM[Copy_Slave]->SMCR |= (u16)(TIMX_SMCR_SMS_EXT_CLK1 << TIMX_SMCR_SMS);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_TIM1_PWM_SetComplementary(GPT_PWM_Channel_t Copy_Channel , GPT_PWM_Mode_t Copy_PWM_Mode , GPT_TIM_POLARITY_t Copy_Polarity)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    u8 Local_Shift = (u8)((Copy_Channel & 1) * 8);
+    u16 Local_Field = (u16)( (Copy_PWM_Mode << 4) | (1 << TIMX_CCMR1_OC1PE) );
+    u16 Local_Polarity = (u16)( (1 << (TIMX_CCER_CC1P + (Copy_Channel * 4))) | (1 << (TIMX_CCER_CC1NP + (Copy_Channel * 4))) );
+    u16 Local_Enable = (u16)( (1 << (TIMX_CCER_CC1E + (Copy_Channel * 4))) | (1 << (TIMX_CCER_CC1NE + (Copy_Channel * 4))) );
+    if ( (Copy_Channel <= TIM_Channel3) && ((Copy_Polarity == Active_High) || (Copy_Polarity == Active_Low)) )
+    {
+        /* CCxS = 00: output; OCxM = PWM mode; OCxPE: the duty changes at the update */
+        if (Copy_Channel <= TIM_Channel2)
+        {
+            TIM[TIM1]->CCMR1 = (u16)( (TIM[TIM1]->CCMR1 & ~(TIMX_CCMR_CH_MASK << Local_Shift)) | (Local_Field << Local_Shift) );
+        }else
+        {
+            TIM[TIM1]->CCMR2 = (u16)( (TIM[TIM1]->CCMR2 & ~(TIMX_CCMR_CH_MASK << Local_Shift)) | (Local_Field << Local_Shift) );
+        }
+        if (Copy_Polarity == Active_Low)
+        {
+            TIM[TIM1]->CCER |= Local_Polarity;
+        }else
+        {
+            TIM[TIM1]->CCER &= (u16)~Local_Polarity;
+        }
+        TIM[TIM1]->CCER |= Local_Enable;
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_TIM1_SetBreakDeadTime(const GPT_BDTR_Config_t* Copy_BDTR_Config)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    u8 Local_DTG;
+    u16 Local_BDTR;
+    if ( (Copy_BDTR_Config != NULL) && (Copy_BDTR_Config->Lock <= TIM_LOCK_LEVEL3)
+      && (Copy_BDTR_Config->BreakEnable <= TIM_BREAK_ENABLED) && (Copy_BDTR_Config->AutomaticOutput <= TIM_AOE_ENABLED)
+      && ((Copy_BDTR_Config->BreakPolarity == Active_High) || (Copy_BDTR_Config->BreakPolarity == Active_Low))
+      && (((TIM[TIM1]->BDTR >> TIMX_BDTR_LOCK) & 0x3) == TIM_LOCK_OFF)
+      && (GPT_DeadTimeToDTG(Copy_BDTR_Config->DeadTimeNs , &Local_DTG) == E_OK) )
+    {
+        Local_BDTR = (u16)( (Local_DTG << TIMX_BDTR_DTG) | (Copy_BDTR_Config->Lock << TIMX_BDTR_LOCK)
+                          | (1 << TIMX_BDTR_OSSI) | (1 << TIMX_BDTR_OSSR)
+                          | (Copy_BDTR_Config->BreakEnable << TIMX_BDTR_BKE)
+                          | (Copy_BDTR_Config->AutomaticOutput << TIMX_BDTR_AOE)
+                          | (1 << TIMX_BDTR_MOE) );
+        if (Copy_BDTR_Config->BreakPolarity == Active_High)
+        {
+            Local_BDTR |= (1 << TIMX_BDTR_BKP);
+        }
+        /* One write: the register fields are interdependent (RM0008 advises a single access) */
+        TIM[TIM1]->BDTR = Local_BDTR;
+        /* LOCK is write-once after reset: an earlier BDTR write (e.g. MOE) leaves it off. MOE may be cleared by a break */
+        if ( (TIM[TIM1]->BDTR & (u16)~(1 << TIMX_BDTR_MOE)) == (Local_BDTR & (u16)~(1 << TIMX_BDTR_MOE)) )
+        {
+            local_functionStates = E_OK;
+        }else
+        {
+            local_functionStates = E_NOT_OK;
+        }
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_TIM1_GetBreakFlag(u8* Copy_BreakFlag)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    if (Copy_BreakFlag != NULL)
+    {
+        *Copy_BreakFlag = (u8)GET_BIT( TIM[TIM1]->SR , TIMX_SR_BIF );
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType GPT_TIM1_ResumeOutputs(void)
+{
+    Std_ReturnType local_functionStates = E_NOT_OK;
+    TIM[TIM1]->SR = (u16)~(1 << TIMX_SR_BIF);
+    SET_BIT( TIM[TIM1]->BDTR , TIMX_BDTR_MOE );
+    /* MOE stays cleared while the break input is active */
+    if (GET_BIT( TIM[TIM1]->BDTR , TIMX_BDTR_MOE ) == 1)
+    {
+        local_functionStates = E_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static Std_ReturnType GPT_DeadTimeToDTG(u32 Copy_DeadTimeNs , u8* Copy_DTG)
+{
+    Std_ReturnType local_functionStates = E_OK;
+    u32 Local_DTSFreq = TIM_Clk_Freq;
+    u64 Local_Ticks;
+    /* tDTS = tCK_INT * 1, 2 or 4 (CR1 CKD) */
+    if (GET_BIT( TIM[TIM1]->CR1 , TIMX_CR1_CKD1 ) == 1)
+    {
+        Local_DTSFreq /= 4;
+    }else if (GET_BIT( TIM[TIM1]->CR1 , TIMX_CR1_CKD0 ) == 1)
+    {
+        Local_DTSFreq /= 2;
+    }else
+    {
+
+    }
+    /* Rounded up: the dead-time is a minimum */
+    Local_Ticks = ( ((u64)Copy_DeadTimeNs * Local_DTSFreq) + (GPT_NS_PER_S - 1) ) / GPT_NS_PER_S;
+    if (Local_Ticks <= GPT_DTG_MAX_DIRECT)
+    {
+        *Copy_DTG = (u8)Local_Ticks;
+    }else if (Local_Ticks <= GPT_DTG_MAX_X2)
+    {
+        /* DT = (64 + DTG[5:0]) x 2 tDTS */
+        *Copy_DTG = (u8)( GPT_DTG_X2 | (((Local_Ticks + 1) / 2) - 64) );
+    }else if (Local_Ticks <= GPT_DTG_MAX_X8)
+    {
+        /* DT = (32 + DTG[4:0]) x 8 tDTS */
+        *Copy_DTG = (u8)( GPT_DTG_X8 | (((Local_Ticks + 7) / 8) - 32) );
+    }else if (Local_Ticks <= GPT_DTG_MAX_X16)
+    {
+        /* DT = (32 + DTG[4:0]) x 16 tDTS */
+        *Copy_DTG = (u8)( GPT_DTG_X16 | (((Local_Ticks + 15) / 16) - 32) );
+    }else
+    {
+        local_functionStates = E_NOT_OK;
+    }
+    return local_functionStates;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
@@ -32,6 +32,11 @@ typedef struct
 #define USART1 ((volatile USART_t*)0x40013800)
 #define USART2 ((volatile USART_t*)0x40004400)
 
+// SR flags; the matching interrupt enables (RXNEIE, TCIE, TXEIE) sit at the same positions in CR1
+#define USART_SR_RXNE       5
+#define USART_SR_TC         6
+#define USART_SR_TXE        7
+
 // IDs for USART peripherals
 #define USART1_ID           0
 #define USART2_ID           1
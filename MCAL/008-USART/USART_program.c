@@ -17,10 +17,16 @@
 #include "BIT_MATH.h"
 #include "STM32F103C8.h"
 /**************************************** MCAL *****************************************************/
+#include "NVIC_interface.h"
+#include "SCB_interface.h"
+#include "SCB_private.h"
+#include "SCB_config.h"
 #include "USART_interface.h"
 #include "USART_private.h"
 #include "USART_config.h"
 
+static void USART_voidWaitFlag(volatile USART_t *Copy_USARTx , u8 Copy_Flag , IRQn_Type Copy_IRQn);
+
 Std_ReturnType USARTx_INIT(u32 Copy_baudRate,u8 Copy_UARTx)
 {
     switch (Copy_UARTx)
@@ -69,11 +75,11 @@ Std_ReturnType USARTx_SendByte(u8 Copy_Byte,u8 Copy_UARTx)
     {
     case USART_1:
         USART1->DR=Copy_Byte;
-        while(GET_BIT(USART1->SR,6)==0);
+        USART_voidWaitFlag(USART1 , USART_SR_TC , NVIC_USART1_IRQn);
         break;
     case USART_2:
         USART2->DR=Copy_Byte;
-        while(GET_BIT(USART2->SR,6)==0);
+        USART_voidWaitFlag(USART2 , USART_SR_TC , NVIC_USART2_IRQn);
         break;
     default: 
         #error "Enter Correct USART ID"
@@ -124,7 +130,7 @@ Std_ReturnType USARTx_SendString(u8* STRINGToSend,u8 Copy_UARTx)
         while(1)
         {
             USART1->DR=STRINGToSend[Local_index];
-            while((GET_BIT((USART1->SR),7)) == 0);
+            USART_voidWaitFlag(USART1 , USART_SR_TXE , NVIC_USART1_IRQn);
             if(STRINGToSend[Local_index]=='\0')
             {
                 break;
@@ -134,13 +140,13 @@ Std_ReturnType USARTx_SendString(u8* STRINGToSend,u8 Copy_UARTx)
                 Local_index++;
             }
         }
-        while(GET_BIT(USART1->SR,6)==0);
+        USART_voidWaitFlag(USART1 , USART_SR_TC , NVIC_USART1_IRQn);
         break;
     case USART_2:
         while(1)
         {
             USART2->DR=STRINGToSend[Local_index];
-            while((GET_BIT((USART2->SR),7)) == 0);
+            USART_voidWaitFlag(USART2 , USART_SR_TXE , NVIC_USART2_IRQn);
             if(STRINGToSend[Local_index]=='\0')
             {
                 break;
@@ -150,7 +156,7 @@ Std_ReturnType USARTx_SendString(u8* STRINGToSend,u8 Copy_UARTx)
                 Local_index++;
             }
         }
-        while(GET_BIT(USART2->SR,6)==0);
+        USART_voidWaitFlag(USART2 , USART_SR_TC , NVIC_USART2_IRQn);
         break;
     default: 
         #error "Enter Correct USART ID"
@@ -175,6 +181,7 @@ Std_ReturnType USARTx_ReceiveString(u8* STRINGToReceive,u8 Copy_UARTx)
             Local_byte=0;
             while(Local_byte==0)
             {
+                USART_voidWaitFlag(USART1 , USART_SR_RXNE , NVIC_USART1_IRQn);
                 USARTx_ReceiveByte(&Local_state,&Local_byte,USART_1);
             }
             STRINGToReceive[Local_index]=Local_byte;
@@ -193,6 +200,7 @@ Std_ReturnType USARTx_ReceiveString(u8* STRINGToReceive,u8 Copy_UARTx)
             Local_byte=0;
             while(Local_byte == 0)
             {
+                USART_voidWaitFlag(USART2 , USART_SR_RXNE , NVIC_USART2_IRQn);
                 USARTx_ReceiveByte(&Local_state,&Local_byte,USART_2);
             }
             STRINGToReceive[Local_index]=Local_byte;
@@ -233,4 +241,32 @@ u16 calcBRRReg(u32 Copy_baudRate,u8 Copy_UARTx)
     
     /* Combine the mantissa and fraction into the BRR register value and return it */
     return ((uint16)((mantissa << 4) | (uint32)fraction));
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Waits for an SR flag, sleeping in MCAL_SCB_BlockingWait between checks.
+ *
+ * With SCB_IDLE_MODE enabled the flag's interrupt enable is set meanwhile so the flag pends the USART line, which wakes
+ * WFE through SEVONPEND while the line stays disabled in the NVIC. An enable the application had already set is left as
+ * it was. Without it the wait is a plain poll and CR1 is not touched.
+ */
+static void USART_voidWaitFlag(volatile USART_t *Copy_USARTx , u8 Copy_Flag , IRQn_Type Copy_IRQn)
+{
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+    u8 Local_WasEnabled = GET_BIT(Copy_USARTx->CR1 , Copy_Flag);
+    SET_BIT(Copy_USARTx->CR1 , Copy_Flag);
+#else
+    (void)Copy_IRQn;
+#endif
+    while(GET_BIT(Copy_USARTx->SR , Copy_Flag) == 0)
+    {
+        MCAL_SCB_BlockingWait();
+    }
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+    if (Local_WasEnabled == 0)
+    {
+        CLR_BIT(Copy_USARTx->CR1 , Copy_Flag);
+        MCAL_NVIC_ClearPendingIRQ(Copy_IRQn);
+    }
+#endif
+}
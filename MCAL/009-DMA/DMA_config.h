@@ -0,0 +1,11 @@
+/**
+ * @brief Configuration of the DMA1 driver.
+ *
+ * The driver has no build-time options yet; each channel is configured at run time with MCAL_DMA_InitChannel.
+ *
+ * @version V01
+ */
+#ifndef DMA_CONFIG_H_
+#define DMA_CONFIG_H_
+
+#endif /* DMA_CONFIG_H_ */
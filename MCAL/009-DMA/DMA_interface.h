@@ -0,0 +1,214 @@
+/**
+ * @brief This module contains functions for configuring and controlling the Direct Memory Access controller (DMA1).
+ *
+ * A channel is described by a DMA_ChannelConfig_t (addresses, count, direction, sizes, increments, circular mode,
+ * priority and interrupts). Callbacks can be attached to the half-transfer, transfer-complete and transfer-error
+ * events. The DMA_REQ_xxx names give the fixed channel of each peripheral request.
+ *
+ * @note This module is intended for use with the STM32F10x microcontroller series.
+ *
+ * @version V01
+ */
+#ifndef DMA_INTERFACE_H_
+#define DMA_INTERFACE_H_
+/**
+ * @name DMA1 Channels
+ * @{
+ */
+#define DMA_CHANNEL1    0
+#define DMA_CHANNEL2    1
+#define DMA_CHANNEL3    2
+#define DMA_CHANNEL4    3
+#define DMA_CHANNEL5    4
+#define DMA_CHANNEL6    5
+#define DMA_CHANNEL7    6
+/** @} */
+/**
+ * @name DMA1 Request Mapping
+ * @brief Fixed channel of each peripheral request (RM0008, DMA1 request mapping).
+ * @{
+ */
+#define DMA_REQ_TIM1_UP         DMA_CHANNEL5
+#define DMA_REQ_TIM2_UP         DMA_CHANNEL2
+#define DMA_REQ_TIM3_UP         DMA_CHANNEL3
+#define DMA_REQ_TIM4_UP         DMA_CHANNEL7
+#define DMA_REQ_USART1_TX       DMA_CHANNEL4
+#define DMA_REQ_USART1_RX       DMA_CHANNEL5
+#define DMA_REQ_USART2_TX       DMA_CHANNEL7
+#define DMA_REQ_USART2_RX       DMA_CHANNEL6
+/** @} */
+/**
+ * @name Transfer Direction
+ * @{
+ */
+#define DMA_DIR_PERIPH_TO_MEM   0
+#define DMA_DIR_MEM_TO_PERIPH   1
+/** @} */
+/**
+ * @name Data Size (peripheral and memory side)
+ * @{
+ */
+#define DMA_SIZE_8BIT           0
+#define DMA_SIZE_16BIT          1
+#define DMA_SIZE_32BIT          2
+/** @} */
+/**
+ * @name Address Increment
+ * @{
+ */
+#define DMA_INC_DISABLE         0
+#define DMA_INC_ENABLE          1
+/** @} */
+/**
+ * @name Transfer Mode
+ * @{
+ */
+#define DMA_MODE_NORMAL         0
+#define DMA_MODE_CIRCULAR       1
+/** @} */
+/**
+ * @name Channel Priority
+ * @{
+ */
+#define DMA_PRIORITY_LOW        0
+#define DMA_PRIORITY_MEDIUM     1
+#define DMA_PRIORITY_HIGH       2
+#define DMA_PRIORITY_VERY_HIGH  3
+/** @} */
+/**
+ * @name Channel Events
+ * @brief Events that can have a callback; also used as the interrupt enable selection.
+ * @{
+ */
+#define DMA_EVENT_TRANSFER_COMPLETE 0
+#define DMA_EVENT_HALF_TRANSFER     1
+#define DMA_EVENT_TRANSFER_ERROR    2
+#define DMA_EVENTS_COUNT            3
+/** @} */
+/**
+ * @name Interrupt Enable Flags
+ * @brief Flags OR-ed into DMA_ChannelConfig_t.Interrupts.
+ * @{
+ */
+#define DMA_INT_NONE                0x00
+#define DMA_INT_TRANSFER_COMPLETE   0x02
+#define DMA_INT_HALF_TRANSFER       0x04
+#define DMA_INT_TRANSFER_ERROR      0x08
+/** @} */
+/**
+ * @name Callback Context
+ * @{
+ */
+#define DMA_CALLBACK_IMMEDIATE      0   /**< Callbacks run inside the channel interrupt (default)   */
+#define DMA_CALLBACK_DEFERRED       1   /**< Callbacks are queued to the PendSV work queue          */
+/** @} */
+
+/**
+ * @brief Type Definition for DMA Callback Function
+ *
+ * DMA callback functions take no arguments and return no values. They run in the DMA channel interrupt.
+ */
+typedef void (*DMA_CallbackFunc_t)(void);
+/**
+ * @brief DMA channel configuration.
+ */
+typedef struct
+{
+    u32 PeripheralAddress;  /**< Address of the peripheral register (CPAR)                      */
+    u32 MemoryAddress;      /**< Address of the memory buffer (CMAR)                            */
+    u16 Count;              /**< Number of data items to transfer (CNDTR), 1..65535              */
+    u8 Direction;           /**< DMA_DIR_PERIPH_TO_MEM / DMA_DIR_MEM_TO_PERIPH                   */
+    u8 PeripheralSize;      /**< DMA_SIZE_8BIT / DMA_SIZE_16BIT / DMA_SIZE_32BIT                 */
+    u8 MemorySize;          /**< DMA_SIZE_8BIT / DMA_SIZE_16BIT / DMA_SIZE_32BIT                 */
+    u8 PeripheralInc;       /**< DMA_INC_DISABLE / DMA_INC_ENABLE                                */
+    u8 MemoryInc;           /**< DMA_INC_DISABLE / DMA_INC_ENABLE                                */
+    u8 Mode;                /**< DMA_MODE_NORMAL / DMA_MODE_CIRCULAR                             */
+    u8 Priority;            /**< DMA_PRIORITY_LOW .. DMA_PRIORITY_VERY_HIGH                      */
+    u8 Interrupts;          /**< OR of DMA_INT_xxx flags                                         */
+}DMA_ChannelConfig_t;
+
+/**
+ * @brief Configures a DMA1 channel.
+ *
+ * This function disables the channel, clears its pending flags and writes the complete configuration (CCR, CNDTR, CPAR, CMAR).
+ * The channel is left disabled; call MCAL_DMA_StartChannel to start the transfer.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[in] Copy_Config Pointer to the channel configuration.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ *
+ * @note The DMA1 clock (RCC_AHB_DMA1EN) must be enabled before calling this function.
+ */
+Std_ReturnType MCAL_DMA_InitChannel(u8 Copy_Channel , const DMA_ChannelConfig_t *Copy_Config);
+/**
+ * @brief Reloads the addresses and the item count of a stopped channel.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[in] Copy_PeripheralAddress New CPAR value.
+ * @param[in] Copy_MemoryAddress New CMAR value.
+ * @param[in] Copy_Count New CNDTR value (1..65535).
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens (also if the channel is running)
+ */
+Std_ReturnType MCAL_DMA_SetTransfer(u8 Copy_Channel , u32 Copy_PeripheralAddress , u32 Copy_MemoryAddress , u16 Copy_Count);
+/**
+ * @brief Enables a configured channel; transfers start on the next peripheral request.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ */
+Std_ReturnType MCAL_DMA_StartChannel(u8 Copy_Channel);
+/**
+ * @brief Disables a channel and clears its pending flags.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ */
+Std_ReturnType MCAL_DMA_StopChannel(u8 Copy_Channel);
+/**
+ * @brief Reads the number of data items still to be transferred (CNDTR).
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[out] Copy_RemainingCount Receives the current CNDTR value.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ */
+Std_ReturnType MCAL_DMA_GetRemainingCount(u8 Copy_Channel , u16 *Copy_RemainingCount);
+/**
+ * @brief Sets the callback of a channel event.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[in] Copy_Event DMA_EVENT_TRANSFER_COMPLETE, DMA_EVENT_HALF_TRANSFER or DMA_EVENT_TRANSFER_ERROR.
+ * @param[in] Copy_CallbackFunc The function called from the channel interrupt, or NULL to remove it.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ *
+ * @note The matching DMA_INT_xxx flag must be set in the channel configuration and the channel IRQ enabled in the NVIC.
+ */
+Std_ReturnType MCAL_DMA_SetCallback(u8 Copy_Channel , u8 Copy_Event , DMA_CallbackFunc_t Copy_CallbackFunc);
+/**
+ * @brief Selects where the callbacks of a channel run.
+ *
+ * With DMA_CALLBACK_DEFERRED the channel interrupt only clears its flags and posts the callbacks to the PendSV work
+ * queue (MCAL_SCB_PostDeferredCallback); if the queue is full or disabled, they run immediately. Keep streaming users
+ * with tight refill deadlines (pattern generator, logic capture) immediate.
+ *
+ * @param[in] Copy_Channel DMA_CHANNEL1 .. DMA_CHANNEL7.
+ * @param[in] Copy_Mode DMA_CALLBACK_IMMEDIATE or DMA_CALLBACK_DEFERRED.
+ *
+ * @retval Std_ReturnType returns E_OK if function ok E_NOK if function error happens
+ */
+Std_ReturnType MCAL_DMA_SetCallbackMode(u8 Copy_Channel , u8 Copy_Mode);
+
+void DMA1_Channel1_IRQHandler(void);
+void DMA1_Channel2_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
+void DMA1_Channel4_IRQHandler(void);
+void DMA1_Channel5_IRQHandler(void);
+void DMA1_Channel6_IRQHandler(void);
+void DMA1_Channel7_IRQHandler(void);
+
+#endif /* DMA_INTERFACE_H_ */
@@ -0,0 +1,72 @@
+/**
+ * @brief Register map and private definitions of the DMA1 driver.
+ *
+ * DMA1 base address, the per-channel register block (CCR, CNDTR, CPAR, CMAR), the CCR bit positions and the layout of
+ * the 4-bit flag groups in ISR/IFCR.
+ *
+ * @version V01
+ */
+#ifndef DMA_PRIVATE_H_
+#define DMA_PRIVATE_H_
+/*******************************< Register Definitions *******************************/
+/**
+ * @brief DMA1 Base Address.
+ *
+ * This macro defines the base address of the DMA1 controller.
+ */
+#define DMA1_BASE_ADDRESS       0x40020000
+/**
+ * @brief DMA Channel Register Map.
+ *
+ * Channel configuration register (CCR), number of data register (CNDTR), peripheral address register (CPAR)
+ * and memory address register (CMAR). Channels are 20 bytes apart.
+ */
+typedef struct
+{
+    volatile u32 CCR;
+    volatile u32 CNDTR;
+    volatile u32 CPAR;
+    volatile u32 CMAR;
+    u32 RESERVED;
+}DMA_Channel_RegDef_t;
+/**
+ * @brief DMA Register Map.
+ *
+ * Interrupt status register (ISR), interrupt flag clear register (IFCR) followed by the 7 channels.
+ */
+typedef struct
+{
+    volatile u32 ISR;
+    volatile u32 IFCR;
+    DMA_Channel_RegDef_t CH[7];
+}DMA_RegDef_t;
+/**
+ * @brief DMA1 Register Access.
+ */
+#define DMA1 ((DMA_RegDef_t*)DMA1_BASE_ADDRESS)
+
+/**< Total number of DMA1 channels */
+#define DMA_CHANNELS_COUNT      7
+/*******************************< CCR *******************************/
+#define DMA_CCR_EN              0
+#define DMA_CCR_TCIE            1
+#define DMA_CCR_HTIE            2
+#define DMA_CCR_TEIE            3
+#define DMA_CCR_DIR             4
+#define DMA_CCR_CIRC            5
+#define DMA_CCR_PINC            6
+#define DMA_CCR_MINC            7
+#define DMA_CCR_PSIZE           8
+#define DMA_CCR_MSIZE           10
+#define DMA_CCR_PL              12
+#define DMA_CCR_MEM2MEM         14
+/*******************************< ISR / IFCR *******************************/
+/**< Each channel owns 4 flag bits in ISR/IFCR: GIF, TCIF, HTIF, TEIF */
+#define DMA_ISR_CHANNEL_SHIFT(CH)   ( (CH) * 4 )
+#define DMA_ISR_GIF             0
+#define DMA_ISR_TCIF            1
+#define DMA_ISR_HTIF            2
+#define DMA_ISR_TEIF            3
+#define DMA_ISR_CHANNEL_MASK    0x0F
+
+#endif /* DMA_PRIVATE_H_ */
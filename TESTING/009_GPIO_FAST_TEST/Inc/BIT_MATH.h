@@ -0,0 +1,18 @@
+/**********************************************************************************************/
+/************************* Author: Mohamed Ali Bayoumi ****************************************/
+/************************* Date: 30/9/2023             ****************************************/
+/************************* Version: 0.1                ****************************************/
+/************************* File_Name: BIT_MATH.h      *****************************************/
+/**********************************************************************************************/
+#ifndef BIT_MATH_H_
+#define BIT_MATH_H_
+
+#define SET_BIT(REG , BIT_NO)           REG |=  (1 << BIT_NO)
+#define CLR_BIT(REG , BIT_NO)           REG &= ~(1 << BIT_NO)
+#define TOG_BIT(REG , BIT_NO)           REG ^=  (1 << BIT_NO)
+#define GET_BIT(REG , BIT_NO)           ((REG & (1 << BIT_NO)) >> BIT_NO)
+#define MOD_2BIT(REG, BIT_NO, VAL)      (REG = (REG &  ~(0x3 << BIT_NO) ) | (VAL<<BIT_NO))
+
+
+
+#endif /* BIT_MATH_H_ */
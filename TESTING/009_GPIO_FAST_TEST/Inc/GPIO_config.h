@@ -0,0 +1,28 @@
+/**
+ * @brief This module contains functions for configuring and controlling General Purpose Input/Output (GPIO) pins.
+ *
+ * @author Mohamed Ali Bayoumi
+ * @date    6 OCT 2023
+ * @version V01
+ *
+ * This module provides functions for configuring the mode, speed, and pull-up/down resistors of GPIO pins,
+ * as well as reading and writing their values. It is designed to be used with ARM Cortex-M processors, and may not be
+ * compatible with other architectures.
+ *
+ * @note This module is intended for use with the STM32F10x microcontroller series, but may be adapted for use with
+ * other compatible processors.
+ */
+#ifndef MCAL_GPIO_CONFIG_H_
+#define MCAL_GPIO_CONFIG_H_
+/**
+ * @brief Pins filtered by the debounce service (MCAL_GPIO_DebounceTick).
+ *
+ * One 16-bit mask per port, bit n set means pin n of that port is debounced. A port with a mask of 0x0000 is not sampled.
+ * A pin must stay at its new level for GPIO_DEBOUNCE_SAMPLES consecutive ticks before the stable state changes, so the
+ * debounce time is GPIO_DEBOUNCE_SAMPLES * (tick period). With a 5 ms tick a pin is accepted after 20 ms.
+ */
+#define GPIO_DEBOUNCE_PORTA_MASK        0x0000
+#define GPIO_DEBOUNCE_PORTB_MASK        0x0000
+#define GPIO_DEBOUNCE_PORTC_MASK        0x0000
+
+#endif /* MCAL_GPIO_INTERFACE_H_ */
\ No newline at end of file
@@ -0,0 +1,848 @@
+/****************************************************************/
+/******* Author    : Mohamed Ali Bayoumi        *****************/
+/******* Date      : 21 OCT 2023                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SCB_program.c              *****************/
+/****************************************************************/
+/**************************************** LIB ******************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**************************************** MCAL *****************************************************/
+#include "RCC_interface.h"
+#include "SCB_interface.h"
+#include "SCB_private.h"
+#include "SCB_config.h"
+/**************************************** Configuration Check *****************************************************/
+#if ( (SCB_CRITICAL_CEILING < 1) || (SCB_CRITICAL_CEILING > 15) )
+    #error "SCB_CRITICAL_CEILING must be in 1..15 (BASEPRI = 0 masks nothing)"
+#endif
+#if SCB_DEFERRED_MODE == SCB_DEFERRED_ENABLED
+#if ( (SCB_DEFERRED_QUEUE_SIZE < 2) || (SCB_DEFERRED_QUEUE_SIZE > 256) || ( (SCB_DEFERRED_QUEUE_SIZE & (SCB_DEFERRED_QUEUE_SIZE - 1)) != 0 ) )
+    #error "SCB_DEFERRED_QUEUE_SIZE must be a power of two in 2..256"
+#endif
+#elif SCB_DEFERRED_MODE != SCB_DEFERRED_DISABLED
+    #error "Wrong SCB_DEFERRED_MODE configuration"
+#endif
+#if ( (SCB_IDLE_MODE != SCB_IDLE_ENABLED) && (SCB_IDLE_MODE != SCB_IDLE_DISABLED) )
+    #error "Wrong SCB_IDLE_MODE configuration"
+#endif
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+#if ( (SCB_NOINIT_USER_WORDS < 1) || (SCB_NOINIT_USER_WORDS > 64) )
+    #error "SCB_NOINIT_USER_WORDS must be in 1..64"
+#endif
+#elif SCB_RESET_SERVICE != SCB_RESET_SERVICE_DISABLED
+    #error "Wrong SCB_RESET_SERVICE configuration"
+#endif
+/**************************************** Global Variables Section *****************************************************/
+#if SCB_DEFERRED_MODE == SCB_DEFERRED_ENABLED
+/**
+ * One queued item. A producer fills Func/Callback/Arg of the slot it reserved and sets Ready last; PendSV only takes
+ * the slot at Tail once Ready is set, so a producer preempted between reservation and publication just delays the
+ * drain until it pends PendSV itself.
+ */
+typedef struct
+{
+    SCB_DeferredFunc_t Func;
+    SCB_DeferredCallback_t Callback;
+    void *Arg;
+    volatile u8 Ready;
+}SCB_DeferredItem_t;
+static SCB_DeferredItem_t SCB_DeferredQueue[SCB_DEFERRED_QUEUE_SIZE];
+/* Free-running indices: Head is reserved by producers with LDREX/STREX, Tail is owned by PendSV */
+static volatile u32 SCB_DeferredHead = 0;
+static volatile u32 SCB_DeferredTail = 0;
+static volatile u32 SCB_DeferredOverflows = 0;
+/**************************************** Static Functions Section *****************************************************/
+static Std_ReturnType SCB_PostItem(SCB_DeferredFunc_t Copy_Func , SCB_DeferredCallback_t Copy_Callback , void *Copy_Arg);
+#endif
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+/* Cycles slept since SCB_IdleWindowStart; only updated with PRIMASK set */
+static volatile u32 SCB_IdleCycles = 0;
+static volatile u32 SCB_IdleWindowStart = 0;
+static volatile u8 SCB_IdleReady = 0;
+/**************************************** Static Functions Section *****************************************************/
+static void SCB_voidCountedSleep(u8 Copy_WaitForEvent);
+#endif
+/* Cycles of MCAL_SCB_DelayCycles outside its loop; measured by MCAL_SCB_InitDelay */
+static u32 SCB_DelayOverhead = SCB_DELAY_OVERHEAD_CYCLES;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+/**
+ * State kept across warm resets. All fields are words, so Crc is the last word and covers everything before it. It is
+ * refreshed on each write: a reset at any time (watchdog included) leaves either sealed content or a block that fails
+ * the check and is cleared.
+ */
+typedef struct
+{
+    u32 Magic;
+    u32 ResetCount;
+    u32 WarmFlags;
+    u32 PendingReason;
+    u32 UserData[SCB_NOINIT_USER_WORDS];
+    u32 Crc;
+}SCB_NoInitBlock_t;
+static SCB_NoInitBlock_t SCB_NoInit __attribute__((section(SCB_NOINIT_SECTION)));
+/* Filled by MCAL_SCB_InitResetService; ordinary .bss, so it reads "not ready" until then */
+static SCB_ResetInfo_t SCB_ResetInfo;
+static u8 SCB_ResetServiceReady = 0;
+/* CRC-32 (IEEE, reflected), four bits per step */
+static const u32 SCB_Crc32Nibble[16] =
+{
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+/**************************************** Static Functions Section *****************************************************/
+static u32 SCB_u32NoInitCrc(void);
+static u8 SCB_u8DecodeResetCause(u8 Copy_Flags);
+#endif
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_SetPriorityGrouping(u32 Copy_PrioirtyGrouping)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SCB_AIRCR=Copy_PrioirtyGrouping;
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void EnableGlobalInterrupts()
+{
+    __asm volatile ("cpsie i");
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DisableGlobalInterrupts()
+{
+    __asm volatile ("cpsid i");
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_EnableMemFault()
+{   
+     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SCB_SHCSR |= ( 1 << SCB_SHCSR_MEMFAULTENA_POS );
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_EnableBusFault()
+{
+     Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SCB_SHCSR |= ( 1 << SCB_SHCSR_BUSFAULTENA_POS );
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_EnableUsageFault()
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SCB_SHCSR |= ( 1 << SCB_SHCSR_USGFAULTENA_POS );
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_ClearBusFault()
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;\
+    SCB_SHCSR &= ~( 1 << SCB_SHCSR_BUSFAULTENA_POS );
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_ClearMemFault()
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SCB_SHCSR &= ~( 1 << SCB_SHCSR_MEMFAULTENA_POS );
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_ClearUsageFault()
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SCB_SHCSR &= ~( 1 << SCB_SHCSR_USGFAULTENA_POS );
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_EnterCritical(u8 *Copy_SavedState)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_BasePri;
+    if (Copy_SavedState != NULL)
+    {
+        __asm volatile ("mrs %0, basepri" : "=r" (Local_BasePri));
+        /* BASEPRI_MAX only writes when it raises the masking level, so a nested entry never lowers it */
+        __asm volatile ("msr basepri_max, %0" : : "r" ((u32)SCB_CRITICAL_CEILING << SCB_PRIORITY_SHIFT) : "memory");
+        *Copy_SavedState = (u8)Local_BasePri;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_ExitCritical(u8 Copy_SavedState)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    __asm volatile ("msr basepri, %0" : : "r" ((u32)Copy_SavedState) : "memory");
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_EnterSleepCritical(u32 *Copy_SavedState)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PriMask;
+    if (Copy_SavedState != NULL)
+    {
+        __asm volatile ("mrs %0, primask" : "=r" (Local_PriMask));
+        __asm volatile ("cpsid i" : : : "memory");
+        *Copy_SavedState = Local_PriMask;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_ExitSleepCritical(u32 Copy_SavedState)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    __asm volatile ("msr primask, %0" : : "r" (Copy_SavedState) : "memory");
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_InitDeferred(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_DEFERRED_MODE == SCB_DEFERRED_ENABLED
+    SCB_SHPR_BYTE(SCB_PENDSV_HANDLER) = SCB_LOWEST_PRIORITY;
+    for (u16 Local_Slot = 0; Local_Slot < SCB_DEFERRED_QUEUE_SIZE; Local_Slot++)
+    {
+        SCB_DeferredQueue[Local_Slot].Ready = 0;
+    }
+    SCB_DeferredTail = SCB_DeferredHead;
+    Local_FunctionStatus = E_OK;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_PostDeferred(SCB_DeferredFunc_t Copy_Func , void *Copy_Arg)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_DEFERRED_MODE == SCB_DEFERRED_ENABLED
+    if (Copy_Func != NULL)
+    {
+        Local_FunctionStatus = SCB_PostItem(Copy_Func , NULL , Copy_Arg);
+    }
+#else
+    (void)Copy_Func;
+    (void)Copy_Arg;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_PostDeferredCallback(SCB_DeferredCallback_t Copy_Callback)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_DEFERRED_MODE == SCB_DEFERRED_ENABLED
+    if (Copy_Callback != NULL)
+    {
+        Local_FunctionStatus = SCB_PostItem(NULL , Copy_Callback , NULL);
+    }
+#else
+    (void)Copy_Callback;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_GetDeferredOverflows(u32 *Copy_Overflows)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_DEFERRED_MODE == SCB_DEFERRED_ENABLED
+    if (Copy_Overflows != NULL)
+    {
+        *Copy_Overflows = SCB_DeferredOverflows;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_Overflows;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_SetVectorTable(u32 Copy_TableAddress)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_TableAddress & ~SCB_VTOR_TBLOFF_MASK) == 0 )
+    {
+        SCB_VTOR = Copy_TableAddress;
+        /* The next exception must fetch its vector from the new table */
+        __asm volatile ("dsb" : : : "memory");
+        __asm volatile ("isb" : : : "memory");
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_GetVectorTable(u32 *Copy_TableAddress)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if (Copy_TableAddress != NULL)
+    {
+        *Copy_TableAddress = SCB_VTOR;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_InitIdle(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+    MCAL_SCB_StartCycleCounter();
+    SET_BIT(SCB_SCR , SCB_SCR_SEVONPEND_POS);
+    SCB_IdleCycles = 0;
+    SCB_IdleWindowStart = SCB_DWT_CYCCNT;
+    SCB_IdleReady = 1;
+    Local_FunctionStatus = E_OK;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_WaitForInterrupt(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+    SCB_voidCountedSleep(0);
+#else
+    __asm volatile ("wfi" : : : "memory");
+#endif
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_WaitForEvent(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+    /* With PRIMASK set only SEVONPEND can wake WFE, so the counted sleep needs it */
+    if (GET_BIT(SCB_SCR , SCB_SCR_SEVONPEND_POS) == 1)
+    {
+        SCB_voidCountedSleep(1);
+    }else
+    {
+        __asm volatile ("wfe" : : : "memory");
+    }
+#else
+    __asm volatile ("wfe" : : : "memory");
+#endif
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_BlockingWait(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+    if (SCB_IdleReady == 1)
+    {
+        SCB_voidCountedSleep(1);
+        Local_FunctionStatus = E_OK;
+    }
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void MCAL_SCB_IdleLoop(void)
+{
+    for (;;)
+    {
+        MCAL_SCB_WaitForInterrupt();
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_SetSleepOnExit(u8 Copy_State)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if (Copy_State == SCB_LOW_POWER_ENABLE)
+    {
+        SET_BIT(SCB_SCR , SCB_SCR_SLEEPONEXIT_POS);
+        Local_FunctionStatus = E_OK;
+    }else if (Copy_State == SCB_LOW_POWER_DISABLE)
+    {
+        CLR_BIT(SCB_SCR , SCB_SCR_SLEEPONEXIT_POS);
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_SetSevOnPend(u8 Copy_State)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if (Copy_State == SCB_LOW_POWER_ENABLE)
+    {
+        SET_BIT(SCB_SCR , SCB_SCR_SEVONPEND_POS);
+        Local_FunctionStatus = E_OK;
+    }else if (Copy_State == SCB_LOW_POWER_DISABLE)
+    {
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+        /* The driver waits rely on it to wake from sources left disabled in the NVIC */
+        Local_FunctionStatus = E_NOT_OK;
+#else
+        CLR_BIT(SCB_SCR , SCB_SCR_SEVONPEND_POS);
+        Local_FunctionStatus = E_OK;
+#endif
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_GetIdleStats(u32 *Copy_IdleCycles , u32 *Copy_ElapsedCycles)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+    u32 Local_PriMask;
+    u32 Local_Now;
+    if ( (Copy_IdleCycles != NULL) && (Copy_ElapsedCycles != NULL) )
+    {
+        MCAL_SCB_EnterSleepCritical(&Local_PriMask);
+        Local_Now = SCB_DWT_CYCCNT;
+        *Copy_IdleCycles = SCB_IdleCycles;
+        *Copy_ElapsedCycles = Local_Now - SCB_IdleWindowStart;
+        SCB_IdleCycles = 0;
+        SCB_IdleWindowStart = Local_Now;
+        MCAL_SCB_ExitSleepCritical(Local_PriMask);
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_IdleCycles;
+    (void)Copy_ElapsedCycles;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_StartCycleCounter(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SET_BIT(SCB_DEMCR , SCB_DEMCR_TRCENA_POS);
+    SET_BIT(SCB_DWT_CTRL , SCB_DWT_CTRL_CYCCNTENA_POS);
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_InitDelay(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_PriMask;
+    u32 Local_Start;
+    u32 Local_ReadCost;
+    s32 Local_Error;
+    MCAL_SCB_StartCycleCounter();
+    MCAL_SCB_EnterSleepCritical(&Local_PriMask);
+    /* Two back-to-back reads give the cost of the measurement itself */
+    Local_Start = SCB_DWT_CYCCNT;
+    Local_ReadCost = SCB_DWT_CYCCNT - Local_Start;
+    Local_Start = SCB_DWT_CYCCNT;
+    MCAL_SCB_DelayCycles(SCB_DELAY_CALIBRATION_CYCLES);
+    Local_Error = (s32)(SCB_DWT_CYCCNT - Local_Start - Local_ReadCost) - SCB_DELAY_CALIBRATION_CYCLES;
+    MCAL_SCB_ExitSleepCritical(Local_PriMask);
+    /* Whatever the delay overshot (or undershot) is overhead the estimate missed */
+    Local_Error += (s32)SCB_DelayOverhead;
+    SCB_DelayOverhead = (Local_Error > 0) ? (u32)Local_Error : 0;
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_DelayCycles(u32 Copy_Cycles)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_Start = SCB_DWT_CYCCNT;
+    if (GET_BIT(SCB_DWT_CTRL , SCB_DWT_CTRL_CYCCNTENA_POS) == 1)
+    {
+        if (Copy_Cycles > SCB_DelayOverhead)
+        {
+            Copy_Cycles -= SCB_DelayOverhead;
+            /* Unsigned difference: correct across the counter wrap */
+            while ( (SCB_DWT_CYCCNT - Local_Start) < Copy_Cycles )
+            {
+            }
+        }
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_InitResetService(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    u8 Local_Flags = 0;
+    MCAL_RCC_GetResetFlags(&Local_Flags);
+    MCAL_RCC_ClearResetFlags();
+    SCB_ResetInfo.Cause = SCB_u8DecodeResetCause(Local_Flags);
+    if ( (SCB_ResetInfo.Cause != SCB_RESET_CAUSE_POWER_ON) && (SCB_NoInit.Magic == SCB_NOINIT_MAGIC) &&
+         (SCB_NoInit.Crc == SCB_u32NoInitCrc()) )
+    {
+        SCB_ResetInfo.Warm = 1;
+        SCB_NoInit.ResetCount++;
+        /* A reason only belongs to the reset it was recorded for */
+        SCB_ResetInfo.Reason = (SCB_ResetInfo.Cause == SCB_RESET_CAUSE_SOFTWARE) ? (u8)SCB_NoInit.PendingReason : SCB_RESET_REASON_NONE;
+    }else
+    {
+        SCB_ResetInfo.Warm = 0;
+        SCB_ResetInfo.Reason = SCB_RESET_REASON_NONE;
+        SCB_NoInit.Magic = SCB_NOINIT_MAGIC;
+        SCB_NoInit.ResetCount = 0;
+        SCB_NoInit.WarmFlags = 0;
+        for (u8 Local_Word = 0; Local_Word < SCB_NOINIT_USER_WORDS; Local_Word++)
+        {
+            SCB_NoInit.UserData[Local_Word] = 0;
+        }
+    }
+    SCB_NoInit.PendingReason = SCB_RESET_REASON_NONE;
+    SCB_NoInit.Crc = SCB_u32NoInitCrc();
+    SCB_ResetInfo.ResetCount = SCB_NoInit.ResetCount;
+    SCB_ResetServiceReady = 1;
+    Local_FunctionStatus = E_OK;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void MCAL_SCB_SoftwareReset(u8 Copy_Reason)
+{
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    if (SCB_ResetServiceReady == 1)
+    {
+        __asm volatile ("cpsid i" : : : "memory");
+        SCB_NoInit.PendingReason = Copy_Reason;
+        SCB_NoInit.Crc = SCB_u32NoInitCrc();
+    }
+#else
+    (void)Copy_Reason;
+#endif
+    /* Complete the block writes before the reset request */
+    __asm volatile ("dsb" : : : "memory");
+    SCB_AIRCR = SCB_AIRCR_VECTKEY | (SCB_AIRCR & SCB_AIRCR_PRIGROUP_MASK) | ( (u32)1 << SCB_AIRCR_SYSRESETREQ_POS );
+    __asm volatile ("dsb" : : : "memory");
+    for (;;)
+    {
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_GetResetInfo(SCB_ResetInfo_t *Copy_Info)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    if ( (Copy_Info != NULL) && (SCB_ResetServiceReady == 1) )
+    {
+        *Copy_Info = SCB_ResetInfo;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_Info;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_GetWarmFlags(u32 *Copy_Flags)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    if ( (Copy_Flags != NULL) && (SCB_ResetServiceReady == 1) )
+    {
+        *Copy_Flags = SCB_NoInit.WarmFlags;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_Flags;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_SetWarmFlags(u32 Copy_Flags)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    u8 Local_State;
+    if (SCB_ResetServiceReady == 1)
+    {
+        MCAL_SCB_EnterCritical(&Local_State);
+        SCB_NoInit.WarmFlags |= Copy_Flags;
+        SCB_NoInit.Crc = SCB_u32NoInitCrc();
+        MCAL_SCB_ExitCritical(Local_State);
+        Local_FunctionStatus = E_OK;
+    }
+#else
+    (void)Copy_Flags;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_ClearWarmFlags(u32 Copy_Flags)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    u8 Local_State;
+    if (SCB_ResetServiceReady == 1)
+    {
+        MCAL_SCB_EnterCritical(&Local_State);
+        SCB_NoInit.WarmFlags &= ~Copy_Flags;
+        SCB_NoInit.Crc = SCB_u32NoInitCrc();
+        MCAL_SCB_ExitCritical(Local_State);
+        Local_FunctionStatus = E_OK;
+    }
+#else
+    (void)Copy_Flags;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_WriteNoInit(u8 Copy_Index , u32 Copy_Value)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    u8 Local_State;
+    if ( (Copy_Index < SCB_NOINIT_USER_WORDS) && (SCB_ResetServiceReady == 1) )
+    {
+        MCAL_SCB_EnterCritical(&Local_State);
+        SCB_NoInit.UserData[Copy_Index] = Copy_Value;
+        SCB_NoInit.Crc = SCB_u32NoInitCrc();
+        MCAL_SCB_ExitCritical(Local_State);
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_Index;
+    (void)Copy_Value;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_SCB_ReadNoInit(u8 Copy_Index , u32 *Copy_Value)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+    if ( (Copy_Index < SCB_NOINIT_USER_WORDS) && (Copy_Value != NULL) && (SCB_ResetServiceReady == 1) )
+    {
+        *Copy_Value = SCB_NoInit.UserData[Copy_Index];
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+#else
+    (void)Copy_Index;
+    (void)Copy_Value;
+#endif
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#if SCB_RESET_SERVICE == SCB_RESET_SERVICE_ENABLED
+/*====================================================   Start_FUNCTION   ====================================================*/
+static u32 SCB_u32NoInitCrc(void)
+{
+    const u8 *Local_Byte = (const u8 *)&SCB_NoInit;
+    u32 Local_Crc = 0xFFFFFFFF;
+    for (u16 Local_Index = 0; Local_Index < (sizeof(SCB_NoInitBlock_t) - sizeof(u32)); Local_Index++)
+    {
+        Local_Crc ^= Local_Byte[Local_Index];
+        Local_Crc = (Local_Crc >> 4) ^ SCB_Crc32Nibble[Local_Crc & 0x0F];
+        Local_Crc = (Local_Crc >> 4) ^ SCB_Crc32Nibble[Local_Crc & 0x0F];
+    }
+    return ~Local_Crc;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Picks the cause from the RCC flags. Every internal reset also pulls NRST, so PIN only counts when alone.
+ */
+static u8 SCB_u8DecodeResetCause(u8 Copy_Flags)
+{
+    u8 Local_Cause = SCB_RESET_CAUSE_UNKNOWN;
+    if (Copy_Flags & RCC_RESET_FLAG_POWER_ON)
+    {
+        Local_Cause = SCB_RESET_CAUSE_POWER_ON;
+    }else if (Copy_Flags & RCC_RESET_FLAG_LOW_POWER)
+    {
+        Local_Cause = SCB_RESET_CAUSE_LOW_POWER;
+    }else if (Copy_Flags & RCC_RESET_FLAG_WWDG)
+    {
+        Local_Cause = SCB_RESET_CAUSE_WWDG;
+    }else if (Copy_Flags & RCC_RESET_FLAG_IWDG)
+    {
+        Local_Cause = SCB_RESET_CAUSE_IWDG;
+    }else if (Copy_Flags & RCC_RESET_FLAG_SOFTWARE)
+    {
+        Local_Cause = SCB_RESET_CAUSE_SOFTWARE;
+    }else if (Copy_Flags & RCC_RESET_FLAG_PIN)
+    {
+        Local_Cause = SCB_RESET_CAUSE_PIN;
+    }else
+    {
+        Local_Cause = SCB_RESET_CAUSE_UNKNOWN;
+    }
+    return Local_Cause;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#endif
+#if SCB_IDLE_MODE == SCB_IDLE_ENABLED
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Sleeps with PRIMASK set and adds the time asleep to SCB_IdleCycles.
+ *
+ * A pending interrupt still wakes WFI (and WFE through SEVONPEND) but its handler only runs once PRIMASK is restored,
+ * so handler time is never counted as idle.
+ */
+static void SCB_voidCountedSleep(u8 Copy_WaitForEvent)
+{
+    u32 Local_PriMask;
+    u32 Local_Start;
+    MCAL_SCB_EnterSleepCritical(&Local_PriMask);
+    Local_Start = SCB_DWT_CYCCNT;
+    if (Copy_WaitForEvent == 1)
+    {
+        __asm volatile ("wfe" : : : "memory");
+    }else
+    {
+        __asm volatile ("wfi" : : : "memory");
+    }
+    SCB_IdleCycles += SCB_DWT_CYCCNT - Local_Start;
+    MCAL_SCB_ExitSleepCritical(Local_PriMask);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#endif
+#if SCB_DEFERRED_MODE == SCB_DEFERRED_ENABLED
+/*====================================================   Start_FUNCTION   ====================================================*/
+static Std_ReturnType SCB_PostItem(SCB_DeferredFunc_t Copy_Func , SCB_DeferredCallback_t Copy_Callback , void *Copy_Arg)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    SCB_DeferredItem_t *Local_Item;
+    u32 Local_Head = SCB_DeferredHead;
+    /* Reserve a slot; the compare-exchange (LDREX/STREX) retries if another priority reserved one meanwhile */
+    do
+    {
+        if ( (Local_Head - SCB_DeferredTail) >= SCB_DEFERRED_QUEUE_SIZE )
+        {
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+        Local_FunctionStatus = E_OK;
+    }while ( !__atomic_compare_exchange_n(&SCB_DeferredHead , &Local_Head , Local_Head + 1 , 0 , __ATOMIC_ACQ_REL , __ATOMIC_RELAXED) );
+    if (Local_FunctionStatus == E_OK)
+    {
+        Local_Item = &SCB_DeferredQueue[Local_Head & (SCB_DEFERRED_QUEUE_SIZE - 1)];
+        Local_Item->Func = Copy_Func;
+        Local_Item->Callback = Copy_Callback;
+        Local_Item->Arg = Copy_Arg;
+        __atomic_store_n(&Local_Item->Ready , 1 , __ATOMIC_RELEASE);
+        SCB_ICSR = ( (u32)1 << SCB_ICSR_PENDSVSET_POS );
+    }else
+    {
+        /* Posters of every priority may overflow at once: count with LDREX/STREX, not a read-modify-write */
+        __atomic_fetch_add(&SCB_DeferredOverflows , 1 , __ATOMIC_RELAXED);
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Drains the deferred work queue in order.
+ *
+ * Runs at the lowest priority, so every posting handler has returned before an item runs. Stops at the first slot
+ * that is reserved but not yet published; its producer pends PendSV again when it publishes.
+ */
+void PendSV_Handler(void)
+{
+    SCB_DeferredItem_t *Local_Item;
+    u32 Local_Tail = SCB_DeferredTail;
+    while (Local_Tail != SCB_DeferredHead)
+    {
+        Local_Item = &SCB_DeferredQueue[Local_Tail & (SCB_DEFERRED_QUEUE_SIZE - 1)];
+        if (__atomic_load_n(&Local_Item->Ready , __ATOMIC_ACQUIRE) == 0)
+        {
+            break;
+        }
+        SCB_DeferredFunc_t Local_Func = Local_Item->Func;
+        SCB_DeferredCallback_t Local_Callback = Local_Item->Callback;
+        void *Local_Arg = Local_Item->Arg;
+        Local_Item->Ready = 0;
+        Local_Tail++;
+        /* Free the slot before running the item, so the item itself can post again */
+        __atomic_store_n(&SCB_DeferredTail , Local_Tail , __ATOMIC_RELEASE);
+        if (Local_Func != NULL)
+        {
+            Local_Func(Local_Arg);
+        }else
+        {
+            Local_Callback();
+        }
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+#endif
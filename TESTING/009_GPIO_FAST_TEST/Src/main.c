@@ -0,0 +1,102 @@
+/**
+ ******************************************************************************
+ * @file           : main.c
+ * @brief          : GPIO toggle-rate benchmark (GPIO_program.c vs GPIO_fast.h)
+ ******************************************************************************
+ * Toggles PA5 BENCH_TOGGLES times with each API and stores the DWT cycle count
+ * of every run in Bench_Cycles[]. Read the array in the debugger (Live
+ * Expressions), or put a scope on PA5: each run is a separate burst separated
+ * by a 1 ms low gap. Build in Release (-O2, DEBUG undefined) to see the
+ * fast-path figure without the debug argument checks.
+ ******************************************************************************
+ */
+
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "STM32F103C8.h"
+#include "RCC_interface.h"
+#include "GPIO_interface.h"
+#include "GPIO_fast.h"
+#include "SCB_interface.h"
+
+#define BENCH_PORT              GPIO_PORTA
+#define BENCH_PIN               GPIO_PIN5
+#define BENCH_TOGGLES           1000
+
+enum
+{
+    BENCH_SET_PIN_VALUE = 0,    /* MCAL_GPIO_SetPinValue(HIGH) / (LOW)       */
+    BENCH_ATOMIC_SET_RESET,     /* MCAL_GPIO_AtomicSetPin / AtomicResetPin   */
+    BENCH_FAST_SET_RESET,       /* MCAL_GPIO_FastSetPin / FastResetPin       */
+    BENCH_FAST_TOGGLE,          /* MCAL_GPIO_FastTogglePin                   */
+    BENCH_COUNT
+};
+
+volatile u32 Bench_Cycles[BENCH_COUNT];
+/* Average cycles per toggle (one edge), x10 to keep one decimal digit without floats */
+volatile u32 Bench_CyclesPerToggleX10[BENCH_COUNT];
+
+static void Bench_Gap(void)
+{
+    MCAL_GPIO_FastResetPin(BENCH_PORT, BENCH_PIN);
+    u32 Local_Start = SCB_DWT_CYCCNT;
+    while( (SCB_DWT_CYCCNT - Local_Start) < (SYSTEM_CLOCK_FREQUENCY / 1000) );
+}
+
+int main(void)
+{
+    u32 Local_Start;
+    u32 Local_Counter;
+
+    MCAL_RCC_InitSysClock();
+    MCAL_Rcc_EnablePrephiral(RCC_APB2_IOPAEN, RCC_APB2);
+    MCAL_GPIO_SetPinMode(BENCH_PORT, BENCH_PIN, GPIO_OUTPUT_HIGH_SPEED_PUSHPULL);
+
+    MCAL_SCB_StartCycleCounter();
+
+    Bench_Gap();
+    Local_Start = SCB_DWT_CYCCNT;
+    for( Local_Counter = 0; Local_Counter < (BENCH_TOGGLES / 2); Local_Counter++ )
+    {
+        MCAL_GPIO_SetPinValue(BENCH_PORT, BENCH_PIN, GPIO_HIGH);
+        MCAL_GPIO_SetPinValue(BENCH_PORT, BENCH_PIN, GPIO_LOW);
+    }
+    Bench_Cycles[BENCH_SET_PIN_VALUE] = SCB_DWT_CYCCNT - Local_Start;
+
+    Bench_Gap();
+    Local_Start = SCB_DWT_CYCCNT;
+    for( Local_Counter = 0; Local_Counter < (BENCH_TOGGLES / 2); Local_Counter++ )
+    {
+        MCAL_GPIO_AtomicSetPin(BENCH_PORT, BENCH_PIN);
+        MCAL_GPIO_AtomicResetPin(BENCH_PORT, BENCH_PIN);
+    }
+    Bench_Cycles[BENCH_ATOMIC_SET_RESET] = SCB_DWT_CYCCNT - Local_Start;
+
+    Bench_Gap();
+    Local_Start = SCB_DWT_CYCCNT;
+    for( Local_Counter = 0; Local_Counter < (BENCH_TOGGLES / 2); Local_Counter++ )
+    {
+        MCAL_GPIO_FastSetPin(BENCH_PORT, BENCH_PIN);
+        MCAL_GPIO_FastResetPin(BENCH_PORT, BENCH_PIN);
+    }
+    Bench_Cycles[BENCH_FAST_SET_RESET] = SCB_DWT_CYCCNT - Local_Start;
+
+    Bench_Gap();
+    Local_Start = SCB_DWT_CYCCNT;
+    for( Local_Counter = 0; Local_Counter < BENCH_TOGGLES; Local_Counter++ )
+    {
+        MCAL_GPIO_FastTogglePin(BENCH_PORT, BENCH_PIN);
+    }
+    Bench_Cycles[BENCH_FAST_TOGGLE] = SCB_DWT_CYCCNT - Local_Start;
+
+    Bench_Gap();
+    for( Local_Counter = 0; Local_Counter < BENCH_COUNT; Local_Counter++ )
+    {
+        Bench_CyclesPerToggleX10[Local_Counter] = (Bench_Cycles[Local_Counter] * 10) / BENCH_TOGGLES;
+    }
+
+    /* Loop forever */
+    for(;;)
+    {
+    }
+}
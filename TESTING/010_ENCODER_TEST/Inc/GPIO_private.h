@@ -0,0 +1,78 @@
+/**
+ * @brief This module contains functions for configuring and controlling General Purpose Input/Output (GPIO) pins.
+ *
+ * @author Mohamed Ali Bayoumi
+ * @date    6 OCT 2023
+ * @version V01
+ *
+ * This module provides functions for configuring the mode, speed, and pull-up/down resistors of GPIO pins,
+ * as well as reading and writing their values. It is designed to be used with ARM Cortex-M processors, and may not be
+ * compatible with other architectures.
+ *
+ * @note This module is intended for use with the STM32F10x microcontroller series, but may be adapted for use with
+ * other compatible processors.
+ */
+
+#ifndef MCAL_GPIO_PRIVATE_H_
+#define MCAL_GPIO_PRIVATE_H_
+
+#define GPIO_BUS                RCC_APB2
+
+#define GPIO_PORTA_BASE_ADDRESS  0x40010800U
+#define GPIO_PORTB_BASE_ADDRESS  0x40010C00U
+#define GPIO_PORTC_BASE_ADDRESS  0x40011000U
+
+#define GPIO_PORTS_COUNT         3
+/*
+#define GPIO_PORTD_BASE_ADDRESS  0x40011400U
+#define GPIO_PORTE_BASE_ADDRESS  0x40011800U
+#define GPIO_PORTF_BASE_ADDRESS  0x40011C00U
+#define GPIO_PORTG_BASE_ADDRESS  0x40012000U
+*/
+/******************************************< REGISTERS ADDRESSES FOR PORT ******************************************/
+typedef struct GPIO_REGISTERS
+{
+    u32 CRL;    /* Port configuration register low  Address offset: 0x00 */
+    u32 CRH;    /* Port configuration register high Address offset: 0x04 */
+    u32 IDR;    /* Port input data register Address offset: 0x08h */
+    u32 ODR;    /* Port output data register Address offset: 0x0C */
+    u32 BSRR;   /* Port bit set/reset register Address offset: 0x10 */
+    u32 BRR;    /* Port bit reset register Address offset: 0x14 */
+    u32 LCKR;   /* Port configuration lock register Address offset: 0x18 */
+}GPIOx_t;
+
+/******************************************< STRUCT FOR PORT ******************************************/
+
+#define MCAL_GPIOA ( (GPIOx_t*) GPIO_PORTA_BASE_ADDRESS )
+#define MCAL_GPIOB ( (GPIOx_t*) GPIO_PORTB_BASE_ADDRESS )
+#define MCAL_GPIOC ( (GPIOx_t*) GPIO_PORTC_BASE_ADDRESS )
+/*
+#define MCAL_GPIOD ( (GPIOx_t*) GPIO_PORTD_BASE_ADDRESS )
+#define MCAL_GPIOE ( (GPIOx_t*) GPIO_PORTE_BASE_ADDRESS )
+#define MCAL_GPIOF ( (GPIOx_t*) GPIO_PORTF_BASE_ADDRESS )
+#define MCAL_GPIOG ( (GPIOx_t*) GPIO_PORTG_BASE_ADDRESS )
+*/
+
+#define LCKK        16
+
+#define GPIO_BSRR_RESET_SHIFT   16
+
+/******************************************< DEBOUNCE SERVICE ******************************************/
+/* Samples needed before a level change is accepted; fixed by the 2-bit vertical counter */
+#define GPIO_DEBOUNCE_SAMPLES   4
+/**
+ * @brief Debounce state of one port, one bit per pin.
+ *
+ * Cnt1:Cnt0 form a 2-bit counter per pin ("vertical" counter: bit 1 of all 16 counters in Cnt1, bit 0 in Cnt0).
+ * The counter runs while the sample differs from State and the state flips when it wraps back to zero.
+ */
+typedef struct
+{
+    u16 State;      /* Debounced level of each pin                          */
+    u16 Cnt0;       /* Bit 0 of the per-pin counters                        */
+    u16 Cnt1;       /* Bit 1 of the per-pin counters                        */
+    u16 Rising;     /* Accepted low->high edges not yet read by the user    */
+    u16 Falling;    /* Accepted high->low edges not yet read by the user    */
+}GPIO_Debounce_t;
+
+#endif /* MCAL_GPIO_PRIVATE_H_ */
\ No newline at end of file
@@ -0,0 +1,782 @@
+/**
+ * @file GPT_interface.h
+ * @brief This file contains the private interface for the GPT module.
+ *
+ * @copyright Copyright (c) 2023
+ * 
+ * This module provides low-level functions for configuring and controlling the general purpose timers in the ARM Cortex-M processor.
+ * The general purpose timers can be used for various timing and synchronization purposes in embedded systems.
+ *
+ * @note This module is designed to be used with ARM Cortex-M processors, and may not be compatible with other architectures.
+ *
+ * @date 28 NOV 2023
+ * @version V01
+ * @author Mohamed Ali Bayoumi
+ */
+#ifndef GPT_INTERFACE_H_
+#define GPT_INTERFACE_H_
+/**
+ * @brief Timer definitions.
+ *
+ * These definitions represent different timer identifiers.
+ */
+#define TIM1    0   /**< Timer 1 */
+#define TIM2    1   /**< Timer 2 */
+#define TIM3    2   /**< Timer 3 */
+#define TIM4    3   /**< Timer 4 */
+
+/**
+ * @brief Timer mode definitions.
+ *
+ * These definitions specify different modes for timer operations.
+ */
+#define TIM_SINGLE_INTERVAL_MODE    0   /**< Single interval mode */
+#define TIM_PERIODIC_INTERVAL_MODE  1   /**< Periodic interval mode */
+
+/**
+ * @brief Callback context definitions.
+ */
+#define TIM_CALLBACK_IMMEDIATE      0   /**< Callback runs inside the update handler (default) */
+#define TIM_CALLBACK_DEFERRED       1   /**< Callback is queued to the PendSV work queue       */
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) clock divider options.
+ *
+ * This enumeration defines different clock divider options for GPT.
+ */
+typedef enum {
+    DIV_1,   /**< Clock divider 1: No division */
+    DIV_2,   /**< Clock divider 2 */
+    DIV_4    /**< Clock divider 4 */
+} GPT_CLKDiv_t;
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) counting directions/modes.
+ *
+ * This enumeration defines different counting directions or modes for GPT.
+ */
+typedef enum {
+    UPCounter,        /**< Up counter mode */
+    DOWNCounter,      /**< Down counter mode */
+    CenterAlligned    /**< Center-aligned mode */
+} GPT_CountDir_t;
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) ARR (Auto-Reload Register) buffer states.
+ *
+ * This enumeration defines states for enabling or disabling ARR buffer in GPT.
+ */
+typedef enum {
+    Disable_Arr_Buffer, /**< Disable ARR buffer */
+    Enable_Arr_Buffer   /**< Enable ARR buffer */
+} GPT_ArrBufferState_t;
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) interrupt states.
+ *
+ * This enumeration defines states for enabling or disabling interrupts in GPT.
+ */
+typedef enum {
+    GPT_Disable_Interrupt, /**< Disable interrupt */
+    GPT_Enable_Interrupt   /**< Enable interrupt */
+} GPT_INTState_t;
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) PWM alignment modes.
+ *
+ * This enumeration defines different PWM alignment modes for GPT.
+ */
+typedef enum {
+    Edge_AllignedMode,       /**< Edge-aligned mode */
+    Center_AllignedMode = 2  /**< Center-aligned mode */
+} GPT_PWM_AllignMode_t;
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) PWM channels.
+ *
+ * This enumeration defines different PWM channels for GPT.
+ */
+typedef enum {
+    TIM_Channel1,   /**< PWM Channel 1 */
+    TIM_Channel2,   /**< PWM Channel 2 */
+    TIM_Channel3,   /**< PWM Channel 3 */
+    TIM_Channel4    /**< PWM Channel 4 */
+} GPT_PWM_Channel_t;
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) PWM modes.
+ *
+ * This enumeration defines different PWM modes for GPT.
+ */
+typedef enum {
+    PWM_11 = 0b110,   /**< PWM mode 11 */
+    PWM_22 = 0b111    /**< PWM mode 22 */
+} GPT_PWM_Mode_t;
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) clock sources.
+ *
+ * This enumeration defines different clock sources for GPT.
+ */
+typedef enum {
+    TIM_CLK_SRC_INTERNAL,            /**< Internal clock source */
+    TIM_CLK_SRC_EXTERNAL_MODE1,     /**< External clock source, mode 1 */
+    TIM_CLK_SRC_EXTERNAL_MODE2      /**< External clock source, mode 2 */
+} GPT_TIM_CLK_SRC_t;
+
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) signal polarities.
+ *
+ * This enumeration defines signal polarities for GPT operations.
+ */
+typedef enum {
+    Active_High,  /**< Active high signal polarity */
+    Active_Low    /**< Active low signal polarity */
+} GPT_TIM_POLARITY_t;
+/**
+ * @brief Enumeration for General Purpose Timer (GPT) edge types.
+ *
+ * This enumeration defines types of edges for GPT timing operations.
+ */
+typedef enum {
+    Rising,   /**< Rising edge */
+    Falling   /**< Falling edge */
+} GPT_TIM_EDGE_t;
+/**
+ * @brief Enumeration for the input of a capture channel (CCxS).
+ */
+typedef enum {
+    TIM_IC_DIRECT = 1,      /**< Channel x captures its own input TIx                       */
+    TIM_IC_INDIRECT = 2,    /**< Channel x captures the neighbour input (CH1<->TI2, CH2<->TI1, CH3<->TI4, CH4<->TI3) */
+    TIM_IC_TRC = 3          /**< Channel x captures the trigger input TRC                   */
+} GPT_IC_Selection_t;
+/**
+ * @brief Enumeration for the capture prescaler (ICxPSC): capture once every N valid edges.
+ */
+typedef enum {
+    TIM_IC_EVERY_EDGE,      /**< Capture on every edge      */
+    TIM_IC_EVERY_2_EDGES,   /**< Capture every 2 edges      */
+    TIM_IC_EVERY_4_EDGES,   /**< Capture every 4 edges      */
+    TIM_IC_EVERY_8_EDGES    /**< Capture every 8 edges      */
+} GPT_IC_Prescaler_t;
+/**
+ * @brief Configuration structure for an input-capture channel.
+ *
+ * The capture latches CNT into CCRx in hardware on the selected edge, so the timestamp is exact to the timer tick
+ * whatever the interrupt latency. The tick is set by the timer prescaler (GPT_TIMx_SetPreScalar), and the counter range
+ * by the period (GPT_TIMx_SetPeriod, 0xFFFF for free running).
+ */
+typedef struct {
+    GPT_PWM_Channel_t Channel;      /**< TIM_Channel1 .. TIM_Channel4                              */
+    GPT_IC_Selection_t Selection;   /**< Input captured by the channel                            */
+    GPT_TIM_EDGE_t Edge;            /**< Rising or Falling                                          */
+    GPT_IC_Prescaler_t Prescaler;   /**< Edges per capture                                        */
+    u8 Filter;                      /**< ICxF 0..15: 0 none, else N samples at fCK_INT or fDTS/x must agree (RM0008) */
+} GPT_IC_Config_t;
+/**
+ * @name DMA burst layouts
+ *
+ * Half-words written by one burst (one record of the table), in register order.
+ * @{
+ */
+#define TIM_BURST_CCR           0   /**< CCR1, CCR2, CCR3, CCR4                                         */
+#define TIM_BURST_ARR_CCR       1   /**< ARR, RCR, CCR1, CCR2, CCR3, CCR4 (TIM1 only, TIM2..TIM4 have no RCR) */
+#define TIM_BURST_CCR_WORDS     4   /**< Record size of TIM_BURST_CCR                                   */
+#define TIM_BURST_ARR_CCR_WORDS 6   /**< Record size of TIM_BURST_ARR_CCR                               */
+/** @} */
+/**
+ * @name DMA burst repeat modes
+ * @{
+ */
+#define TIM_BURST_ONE_SHOT      0   /**< Play the table once; the last record stays in effect           */
+#define TIM_BURST_CIRCULAR      1   /**< Replay the table forever                                       */
+/** @} */
+/**
+ * @brief Enumeration for the TIM1 lock levels (BDTR LOCK), writable once after reset.
+ */
+typedef enum {
+    TIM_LOCK_OFF,       /**< No lock                                                              */
+    TIM_LOCK_LEVEL1,    /**< Dead-time, break enable/polarity, AOE and idle states locked          */
+    TIM_LOCK_LEVEL2,    /**< Level 1 + channel polarities and off-state selections                 */
+    TIM_LOCK_LEVEL3     /**< Level 2 + output compare modes and preloads                           */
+} GPT_LockLevel_t;
+/**
+ * @name TIM1 break and automatic output switches
+ * @{
+ */
+#define TIM_BREAK_DISABLED      0
+#define TIM_BREAK_ENABLED       1
+#define TIM_AOE_DISABLED        0   /**< After a break, outputs stay off until GPT_TIM1_ResumeOutputs        */
+#define TIM_AOE_ENABLED         1   /**< After a break, outputs restart at the first update with BKIN inactive */
+/** @} */
+/**
+ * @brief Break and dead-time configuration of TIM1.
+ */
+typedef struct {
+    u32 DeadTimeNs;                     /**< Delay between one output of a pair turning off and the other turning on */
+    u8 BreakEnable;                     /**< TIM_BREAK_DISABLED / TIM_BREAK_ENABLED (BKIN pin, PB12)                 */
+    GPT_TIM_POLARITY_t BreakPolarity;   /**< Active_High / Active_Low level of BKIN that shuts the outputs off      */
+    u8 AutomaticOutput;                 /**< TIM_AOE_DISABLED / TIM_AOE_ENABLED                                      */
+    GPT_LockLevel_t Lock;               /**< Lock level applied with this configuration                             */
+} GPT_BDTR_Config_t;
+/**
+ * @brief Marks an unused stage of a timer chain.
+ */
+#define TIM_CHAIN_NONE          0xFF
+/**
+ * @brief A chain of timers forming one 32-bit or 48-bit counter.
+ *
+ * Low counts the prescaled timer clock; its update event, routed as TRGO to the next timer's ITRx input in external
+ * clock mode 1, clocks Mid, and Mid's update clocks High the same way. The carries are propagated in hardware, so no
+ * overflow interrupt is needed.
+ */
+typedef struct {
+    u8 Low;     /**< Counter bits 0..15                                     */
+    u8 Mid;     /**< Counter bits 16..31                                    */
+    u8 High;    /**< Counter bits 32..47, or TIM_CHAIN_NONE for 32 bits     */
+} GPT_Chain_t;
+/**
+ * @brief Enumeration for the encoder interface counting mode (SMCR SMS).
+ */
+typedef enum {
+    TIM_ENCODER_X2_TI2 = 1,     /**< SMS 001: counts on TI2 edges, direction from the TI1 level */
+    TIM_ENCODER_X2_TI1 = 2,     /**< SMS 010: counts on TI1 edges, direction from the TI2 level */
+    TIM_ENCODER_X4 = 3          /**< SMS 011: counts on both inputs' edges (4 counts per line)   */
+} GPT_EncoderMode_t;
+/**
+ * @brief No timestamp timer: GPT_Encoder_GetVelocity then uses count deltas only.
+ */
+#define TIM_ENCODER_NO_TIMESTAMP    0xFF
+/**
+ * @brief Configuration structure for the encoder interface.
+ *
+ * The A/B signals go to the channel 1 and channel 2 pins of the timer, configured as inputs by the application.
+ */
+typedef struct {
+    GPT_EncoderMode_t Mode;         /**< Counting mode                                             */
+    GPT_TIM_EDGE_t TI1Polarity;     /**< Rising: TI1 as is, Falling: TI1 inverted                  */
+    GPT_TIM_EDGE_t TI2Polarity;     /**< Rising: TI2 as is, Falling: TI2 inverted (reverses the count direction) */
+    u8 Filter;                      /**< ICxF 0..15 applied to both inputs                          */
+    u8 TimestampTIMx;               /**< Free timer latching the TI1 edge times, or TIM_ENCODER_NO_TIMESTAMP */
+} GPT_Encoder_Config_t;
+/**
+ * @brief Configuration structure for General Purpose Timer (GPT) settings.
+ *
+ * This structure defines parameters required to configure the GPT module.
+ */
+typedef struct {
+    u16 ARR;                            /**< Auto-Reload Register value */
+    u16 Prescalar;                      /**< Prescaler value */
+    GPT_CountDir_t GPT_DIR;             /**< GPT counting direction */
+    GPT_PWM_AllignMode_t AllignMode;    /**< PWM alignment mode */
+    GPT_CLKDiv_t CLK_Factor;            /**< GPT clock division factor */
+    GPT_ArrBufferState_t ARB;           /**< ARR (Auto-Reload Register) buffer state */
+    GPT_INTState_t INTState;            /**< GPT interrupt state */
+} GPT_Config_t;
+/**
+ * @brief Configuration structure for General Purpose Timer (GPT) PWM settings.
+ *
+ * This structure defines parameters required to configure PWM (Pulse Width Modulation)
+ * using a GPT for a specific channel.
+ */
+typedef struct {
+    u16 ARR;                        /**< Auto-Reload Register value */
+    GPT_PWM_Channel_t PWM_Channel;  /**< PWM channel */
+    u16 Freq;                       /**< Frequency of the PWM signal */
+    GPT_PWM_Mode_t PWM_Mode;        /**< Mode of PWM operation */
+} GPT_PWM_Config_t;
+/**
+ * @brief Initializes and configures the General Purpose Timer (GPT) module.
+ *
+ * This function initializes and configures the specified GPT timer indicated by 'Copy_TIMx'
+ * based on the provided GPT configuration 'Copy_GPT_Config'.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in] Copy_GPT_Config   Pointer to the configuration structure for GPT.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : GPT initialization successful.
+ *   - E_NOT_OK : Error occurred during GPT initialization (invalid timer or configuration).
+ */
+Std_ReturnType GPT_TIMx_init(u8 Copy_TIMx,GPT_Config_t* Copy_GPT_Config);
+/**
+ * @brief Sets the GPT timer to perform a busy wait for a specified number of ticks.
+ *
+ * This function configures the specified GPT timer indicated by 'Copy_TIMx'
+ * to perform a busy wait for a specified number of ticks ('Copy_Ticks') based on
+ * the specified tick type ('Copy_TickType').
+ *
+ * The timer runs in one-pulse mode and the core sleeps in MCAL_SCB_BlockingWait until its update event; the timer
+ * callback is not called for that update.
+ *
+ * @param[in] Copy_TIMx       The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in] Copy_Ticks      Number of ticks for the busy wait.
+ * @param[in] Copy_TickType   Type of ticks to wait for (e.g., rising edge, falling edge, etc.).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : GPT busy wait configured successfully.
+ *   - E_NOT_OK : Error occurred during GPT configuration (invalid timer or parameters).
+ */
+Std_ReturnType GPT_TIMx_SetBusyWait(u8 Copy_TIMx,u16 Copy_Ticks , u16 Copy_TickType);
+/**
+ * @brief Sets the GPT timer for a single interval with a specified callback function.
+ *
+ * This function configures the specified GPT timer indicated by 'Copy_TIMx' to trigger
+ * a single interval after a specified number of ticks ('Copy_Ticks') based on the specified
+ * tick type ('Copy_TickType'). Upon completion of the interval, the provided callback function
+ * ('Copy_voidpF') will be executed.
+ *
+ * @param[in] Copy_TIMx       The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in] Copy_Ticks      Number of ticks for the interval.
+ * @param[in] Copy_TickType   Type of ticks to wait for (e.g., rising edge, falling edge, etc.).
+ * @param[in] Copy_voidpF     Pointer to the callback function to be executed after the interval.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : GPT interval set successfully.
+ *   - E_NOT_OK : Error occurred during GPT configuration (invalid timer or parameters).
+ */
+Std_ReturnType GPT_TIMx_SetIntervalSingle(u8 Copy_TIMx,u16 Copy_Ticks , u16 Copy_TickType, void (*Copy_voidpF)(void));
+/**
+ * @brief Sets the GPT timer for periodic intervals with a specified callback function.
+ *
+ * This function configures the specified GPT timer indicated by 'Copy_TIMx' to trigger
+ * periodic intervals after a specified number of ticks ('Copy_Ticks') based on the specified
+ * tick type ('Copy_TickType'). Upon completion of each interval, the provided callback function
+ * ('Copy_voidpF') will be executed.
+ *
+ * @param[in] Copy_TIMx       The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in] Copy_Ticks      Number of ticks for each periodic interval.
+ * @param[in] Copy_TickType   Type of ticks to wait for (e.g., rising edge, falling edge, etc.).
+ * @param[in] Copy_voidpF     Pointer to the callback function to be executed after each interval.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : GPT periodic intervals set successfully.
+ *   - E_NOT_OK : Error occurred during GPT configuration (invalid timer or parameters).
+ */
+Std_ReturnType GPT_TIMx_SetIntervalPeriodic(u8 Copy_TIMx,u16 Copy_Ticks , u16 Copy_TickType, void (*Copy_voidpF)(void));
+/**
+ * @brief Retrieves the remaining time of the GPT timer.
+ *
+ * This function retrieves the remaining time of the specified GPT timer ('Copy_TIMx') based on
+ * the specified counting direction ('Copy_CountDir') and stores the remaining time in the
+ * variable pointed to by 'Copy_Remaining'.
+ *
+ * @param[in]  Copy_TIMx      The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in]  Copy_CountDir  Counting direction for the timer.
+ * @param[out] Copy_Remaining Pointer to store the remaining time of the timer.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Remaining time retrieval successful.
+ *   - E_NOT_OK : Error occurred during retrieval (invalid timer or parameters).
+ */
+
+Std_ReturnType GPT_TIMx_GetRemainingTime(u8 Copy_TIMx,GPT_CountDir_t Copy_CountDir , u16* Copy_Remaining);
+/**
+ * @brief Initializes and configures the General Purpose Timer (GPT) for PWM generation.
+ *
+ * This function initializes and configures the specified GPT timer indicated by 'Copy_TIMx'
+ * for PWM (Pulse Width Modulation) generation based on the provided PWM configuration
+ * 'Copy_PWM_Config'.
+ *
+ * @param[in] Copy_TIMx          The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in] Copy_PWM_Config    Pointer to the configuration structure for PWM generation.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : GPT PWM initialization successful.
+ *   - E_NOT_OK : Error occurred during GPT PWM initialization (invalid timer or configuration).
+ */
+Std_ReturnType GPT_PWM_INIT(u8 Copy_TIMx,GPT_PWM_Config_t* Copy_PWM_Config);
+/**
+ * @brief Sets the duty cycle for a specific channel of the GPT timer configured for PWM.
+ *
+ * This function sets the duty cycle for a specific channel ('Copy_Channel') of the GPT timer
+ * indicated by 'Copy_TIMx', which has been configured for PWM (Pulse Width Modulation).
+ * The duty cycle value ('Copy_DutyCycle') determines the ratio of the signal's high time
+ * to the total period. The duty cycle is set as a percentage value (0 to 100).
+ *
+ * @param[in] Copy_TIMx       The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in] Copy_Channel    The specific channel for which the duty cycle is to be set.
+ * @param[in] Copy_DutyCycle  Duty cycle value to set for the channel (0 to 100).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Duty cycle set successfully.
+ *   - E_NOT_OK : Error occurred while setting the duty cycle or invalid parameters.
+ */
+Std_ReturnType GPT_PWM_SetDutyCycle(u8 Copy_TIMx,GPT_PWM_Channel_t Copy_Channel , u8 Copy_DutyCycle);
+/**
+ * @brief Deinitializes and stops PWM for a specific channel of the GPT timer.
+ *
+ * This function deinitializes and stops the PWM (Pulse Width Modulation) operation
+ * for a specific channel ('Copy_Channel') of the GPT timer indicated by 'Copy_TIMx'.
+ *
+ * @param[in] Copy_TIMx       The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[in] Copy_Channel    The specific channel for which PWM is to be deinitialized.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : PWM deinitialization successful.
+ *   - E_NOT_OK : Error occurred during PWM deinitialization or invalid parameters.
+ */
+Std_ReturnType GPT_PWM_DEINIT(u8 Copy_TIMx,GPT_PWM_Channel_t Copy_Channel);
+/**
+ * @brief Retrieves the counter value of the GPT timer used for PWM.
+ *
+ * This function retrieves the current counter value of the GPT timer ('Copy_TIMx')
+ * used for PWM (Pulse Width Modulation) and stores it in the variable pointed to by 'Copy_PWMValue'.
+ *
+ * @param[in]  Copy_TIMx      The identifier for the GPT timer (e.g., TIM1, TIM2, etc.).
+ * @param[out] Copy_PWMValue  Pointer to store the current PWM counter value.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Counter value retrieval successful.
+ *   - E_NOT_OK : Error occurred during retrieval or invalid parameters.
+ */
+Std_ReturnType GPT_PWM_GetCounterValue(u8 Copy_TIMx,u16* Copy_PWMValue);
+/**
+ * @brief Enables the specified General Purpose Timer (GPT).
+ *
+ * This function enables the General Purpose Timer (GPT) indicated by 'Copy_GPT_TIMx'.
+ *
+ * @param[in] Copy_GPT_TIMx The identifier for the GPT timer to be enabled.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : GPT enabled successfully.
+ *   - E_NOT_OK : Error occurred while enabling GPT or invalid parameters.
+ */
+Std_ReturnType GPT_TIMx_Enable(u8 Copy_GPT_TIMx);
+/**
+ * @brief Disables the specified General Purpose Timer (GPT).
+ *
+ * This function disables the General Purpose Timer (GPT) indicated by 'Copy_GPT_TIMx'.
+ *
+ * @param[in] Copy_GPT_TIMx The identifier for the GPT timer to be disabled.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : GPT disabled successfully.
+ *   - E_NOT_OK : Error occurred while disabling GPT or invalid parameters.
+ */
+Std_ReturnType GPT_TIMx_Disable(u8 Copy_GPT_TIMx);
+/**
+ * @brief Configures the timer to pace a DMA channel with its update event.
+ *
+ * This function stops the counter, loads the prescaler and the period, forces an update (UG) so the new prescaler is
+ * used from the first period, clears the update flag and then enables the update DMA request (UDE). The update request
+ * is issued after the UG, so no DMA transfer is triggered by the configuration itself. Start the counter with GPT_TIMx_Enable
+ * once the DMA channel is armed; one DMA transfer then happens every (Prescalar + 1) * (Period + 1) timer clock cycles.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (TIM1 .. TIM4).
+ * @param[in] Copy_Prescalar    The prescaler value (PSC).
+ * @param[in] Copy_Period       The period value (ARR).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Update DMA request configured successfully.
+ *   - E_NOT_OK : Invalid timer.
+ *
+ * @note The update request of each timer is wired to a fixed DMA1 channel (see DMA_REQ_TIMx_UP in DMA_interface.h).
+ */
+Std_ReturnType GPT_TIMx_SetUpdateDMA(u8 Copy_TIMx , u16 Copy_Prescalar , u16 Copy_Period);
+/**
+ * @brief Stops the counter and disables the update DMA request of the timer.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (TIM1 .. TIM4).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Update DMA request disabled successfully.
+ *   - E_NOT_OK : Invalid timer.
+ */
+Std_ReturnType GPT_TIMx_ClearUpdateDMA(u8 Copy_TIMx);
+/**
+ * @brief Selects where the interval callback of a timer runs.
+ *
+ * With TIM_CALLBACK_DEFERRED the update handler only clears its flag and posts the callback to the PendSV work queue
+ * (MCAL_SCB_PostDeferredCallback); if the queue is full or disabled, the callback runs immediately.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (TIM1 .. TIM4).
+ * @param[in] Copy_Mode         TIM_CALLBACK_IMMEDIATE or TIM_CALLBACK_DEFERRED.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Mode set.
+ *   - E_NOT_OK : Invalid timer or mode.
+ */
+Std_ReturnType GPT_TIMx_SetCallbackMode(u8 Copy_TIMx , u8 Copy_Mode);
+/**
+ * @brief Configures a channel as input capture.
+ *
+ * The channel is disabled while its CCMR byte (CCxS, ICxPSC, ICxF) and polarity are written, then enabled with its
+ * capture and overcapture flags cleared. The pin (see the pin table in GPT_config.h) must be configured as a floating
+ * or pulled input by the application. The counter is started with GPT_TIMx_Enable.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (TIM1 .. TIM4).
+ * @param[in] Copy_IC_Config    The channel configuration.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Channel configured.
+ *   - E_NOT_OK : Invalid timer, channel or field.
+ */
+Std_ReturnType GPT_IC_INIT(u8 Copy_TIMx , GPT_IC_Config_t* Copy_IC_Config);
+/**
+ * @brief Reads the last capture of a channel, if a new one happened.
+ *
+ * Reading CCRx clears its capture flag, so each capture is returned once. Intervals between captures are differences
+ * of u16 values (modulo the period + 1).
+ *
+ * @param[in]  Copy_TIMx        The identifier for the GPT timer (TIM1 .. TIM4).
+ * @param[in]  Copy_Channel     TIM_Channel1 .. TIM_Channel4.
+ * @param[out] Copy_Capture     Receives the captured counter value.
+ * @param[out] Copy_Missed      Receives 1 if captures were overwritten before this read (overcapture), else 0; may be NULL.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : A new capture was read.
+ *   - E_NOT_OK : No new capture, or invalid parameters.
+ */
+Std_ReturnType GPT_IC_Read(u8 Copy_TIMx , GPT_PWM_Channel_t Copy_Channel , u16* Copy_Capture , u8* Copy_Missed);
+/**
+ * @brief Configures PWM-input mode on the TI1 pin (channel 1 pin) of the timer.
+ *
+ * CH1 captures TI1 on Copy_Edge and CH2 captures TI1 on the opposite edge; TI1FP1 is the trigger of the slave
+ * controller in reset mode, so each Copy_Edge restarts the counter. CCR1 then holds the period and CCR2 the pulse
+ * width (time from Copy_Edge to the opposite edge), both measured by the hardware in timer ticks. Channels 1 and 2
+ * are used; the counter is started with GPT_TIMx_Enable. Set the period to 0xFFFF and a prescaler giving a tick much
+ * shorter than the signal period.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (TIM1 .. TIM4).
+ * @param[in] Copy_Edge         Rising: pulse = high time, Falling: pulse = low time.
+ * @param[in] Copy_Filter       ICxF 0..15 for TI1.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : PWM-input configured.
+ *   - E_NOT_OK : Invalid timer or filter.
+ */
+Std_ReturnType GPT_IC_PWMInput_INIT(u8 Copy_TIMx , GPT_TIM_EDGE_t Copy_Edge , u8 Copy_Filter);
+/**
+ * @brief Reads the last period and pulse width measured in PWM-input mode, if a new period ended.
+ *
+ * CCR2 is read before CCR1 so both values belong to the same period, as long as the read comes before the next
+ * opposite edge (within the pulse of the next period).
+ *
+ * @param[in]  Copy_TIMx        The identifier for the GPT timer (TIM1 .. TIM4).
+ * @param[out] Copy_Period      Receives the period in timer ticks.
+ * @param[out] Copy_Pulse       Receives the pulse width in timer ticks.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : A new measurement was read.
+ *   - E_NOT_OK : No period ended since the last read (or no signal), or invalid parameters.
+ */
+Std_ReturnType GPT_IC_PWMInput_Read(u8 Copy_TIMx , u16* Copy_Period , u16* Copy_Pulse);
+/**
+ * @brief Configures and starts the quadrature encoder interface on TIM2, TIM3 or TIM4.
+ *
+ * The timer counts the encoder edges itself, up or down, with no interrupt per edge. ARR is set to 0xFFFF and the
+ * update interrupt extends the 16-bit counter to a signed 32-bit position: at each wrap the counter value tells the
+ * direction (below 0x8000 after wrapping up, above after wrapping down), so the interrupt may be served up to half a
+ * counter range late. The position starts at 0. The timer's interrupt (TIMx_IRQHandler) must be enabled in the NVIC
+ * by the application; it is also used by GPT_Encoder_GetVelocity at low speed.
+ *
+ * With a timestamp timer, every TI1 capture of the encoder timer is sent on its TRGO (MMS = 011) to the ITRx input of
+ * the timestamp timer, which runs free at the timer clock and latches its counter in CCR1 (CC1S = TRC). The edge time
+ * and the position at the edge are both taken by the hardware. The timestamp timer is used up by this encoder; only its
+ * channel 1 capture is used, not its pins.
+ *
+ * @param[in] Copy_TIMx             TIM2, TIM3 or TIM4.
+ * @param[in] Copy_Encoder_Config   The encoder configuration.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Encoder interface running.
+ *   - E_NOT_OK : Invalid timer or field, or the timestamp timer is the encoder timer or another encoder.
+ */
+Std_ReturnType GPT_Encoder_INIT(u8 Copy_TIMx , GPT_Encoder_Config_t* Copy_Encoder_Config);
+/**
+ * @brief Streams a table of compare (and period) values into the timer, one record per update event, through DMA.
+ *
+ * DCR points the DMA burst at CCR1 (or ARR) and each update requests one burst: the timer's update DMA channel writes
+ * the record to DMAR and the timer forwards its half-words to consecutive registers. The PWM channels keep their
+ * compare preload (GPT_TIMx_PWM_SetChannel), and ARR preload is enabled for TIM_BURST_ARR_CCR, so all values of a
+ * record take effect together at the next update. The first record is written at the first update after the call.
+ * The counter keeps running; the CPU is not involved while the table plays.
+ *
+ * Uses the DMA1 channel of the timer's update request (DMA_REQ_TIMx_UP), whose clock must be enabled. The table must
+ * stay valid while it plays.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (TIM1 .. TIM4), already running PWM.
+ * @param[in] Copy_Table        Records of TIM_BURST_CCR_WORDS or TIM_BURST_ARR_CCR_WORDS half-words.
+ * @param[in] Copy_Records      Number of records; Copy_Records * record size must not exceed 65535.
+ * @param[in] Copy_Layout       TIM_BURST_CCR, or TIM_BURST_ARR_CCR on TIM1.
+ * @param[in] Copy_Repeat       TIM_BURST_ONE_SHOT or TIM_BURST_CIRCULAR.
+ * @param[in] Copy_DoneFunc     Called from the DMA interrupt at the end of the table (each wrap if circular); NULL
+ *                              keeps the DMA interrupt off. Its IRQ must be enabled in the NVIC when used.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Burst streaming armed.
+ *   - E_NOT_OK : Invalid parameters (including TIM_BURST_ARR_CCR on TIM2..TIM4), or the DMA channel could not be set up.
+ */
+Std_ReturnType GPT_PWM_StartBurst(u8 Copy_TIMx , const u16* Copy_Table , u16 Copy_Records , u8 Copy_Layout , u8 Copy_Repeat , void (*Copy_DoneFunc)(void));
+/**
+ * @brief Stops a burst stream. The counter keeps running with the last written values.
+ *
+ * @param[in] Copy_TIMx         The identifier for the GPT timer (TIM1 .. TIM4).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Stream stopped.
+ *   - E_NOT_OK : Invalid timer.
+ */
+Std_ReturnType GPT_PWM_StopBurst(u8 Copy_TIMx);
+/**
+ * @brief Configures a timer chain and clears it; the chain is left stopped.
+ *
+ * All stages get ARR = 0xFFFF. Low gets Copy_Prescalar and outputs its update on TRGO (and so does Mid in a 48-bit
+ * chain); Mid and High run in external clock mode 1 on the ITRx of the previous stage. With the 36 MHz timer clock,
+ * Copy_Prescalar = 35 counts microseconds: 71 minutes in 32 bits, 8.9 years in 48 bits.
+ *
+ * @param[in] Copy_Chain        The timers of the chain (distinct, TIM1 .. TIM4).
+ * @param[in] Copy_Prescalar    Prescaler of the low stage (PSC).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Chain configured.
+ *   - E_NOT_OK : Invalid or repeated timer.
+ */
+Std_ReturnType GPT_Chain_INIT(const GPT_Chain_t* Copy_Chain , u16 Copy_Prescalar);
+/**
+ * @brief Starts a configured chain. The upper stages are enabled first so no carry of the low stage is lost.
+ *
+ * @param[in] Copy_Chain        The chain given to GPT_Chain_INIT.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Chain started.
+ *   - E_NOT_OK : Invalid chain.
+ */
+Std_ReturnType GPT_Chain_Start(const GPT_Chain_t* Copy_Chain);
+/**
+ * @brief Stops a chain, keeping its count. The low stage is stopped first.
+ *
+ * @param[in] Copy_Chain        The chain given to GPT_Chain_INIT.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Chain stopped.
+ *   - E_NOT_OK : Invalid chain.
+ */
+Std_ReturnType GPT_Chain_Stop(const GPT_Chain_t* Copy_Chain);
+/**
+ * @brief Reads the chain counter as one consistent value.
+ *
+ * The upper stages are read around the low stage and the read is retried if they changed; a low value read just after
+ * a wrap takes the upper stages again once the carry has propagated. Lock-free and usable from any context. For a
+ * 32-bit chain the result fits in 32 bits.
+ *
+ * @param[in]  Copy_Chain       The chain given to GPT_Chain_INIT.
+ * @param[out] Copy_Count       Receives the counter, in low-stage ticks.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Counter read.
+ *   - E_NOT_OK : Invalid chain or NULL pointer.
+ */
+Std_ReturnType GPT_Chain_Read(const GPT_Chain_t* Copy_Chain , u64* Copy_Count);
+/**
+ * @brief Configures a complementary PWM pair of TIM1 (CHx on PA8/PA9/PA10, CHxN on PB13/PB14/PB15).
+ *
+ * Both outputs are enabled (CCxE, CCxNE) with the same active level; the dead-time generator inserts
+ * GPT_BDTR_Config_t.DeadTimeNs between one output turning off and the other turning on, so the two gates of a
+ * half-bridge leg are never driven together. The outputs stay inactive until MOE is set by GPT_TIM1_SetBreakDeadTime.
+ * The duty is set with GPT_PWM_SetDutyCycle; compare preload is enabled.
+ *
+ * @param[in] Copy_Channel      TIM_Channel1 .. TIM_Channel3 (channel 4 has no complementary output).
+ * @param[in] Copy_PWM_Mode     The PWM mode of the pair.
+ * @param[in] Copy_Polarity     Active level of both outputs.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Pair configured.
+ *   - E_NOT_OK : Invalid channel or polarity.
+ */
+Std_ReturnType GPT_TIM1_PWM_SetComplementary(GPT_PWM_Channel_t Copy_Channel , GPT_PWM_Mode_t Copy_PWM_Mode , GPT_TIM_POLARITY_t Copy_Polarity);
+/**
+ * @brief Writes the dead-time, break and lock configuration of TIM1 in one BDTR access, and enables the outputs (MOE).
+ *
+ * The dead-time is rounded up to the DTG encoding of the dead-time clock (timer clock divided by the CKD setting):
+ * steps of 1, 2, 8 and 16 tDTS up to 1008 tDTS, i.e. 28 us with the 36 MHz timer clock and no division. With the
+ * break enabled, the active BKIN level clears MOE in hardware, asynchronously to the clock, and the outputs go to their
+ * off level (off-state run and idle selections are set, so the pins stay driven). Configure the pairs first: from
+ * level 2 on, the lock also freezes the channel polarities.
+ *
+ * @warning The LOCK field is frozen by the first write to BDTR after reset, whatever its value. This call must be the
+ * first BDTR access: GPT_TIM1_PWM_SetComplementary does not touch BDTR, but GPT_TIMx_PWM_SetChannel on TIM1 sets MOE
+ * and so locks the level at off. BDTR is read back after the write and a mismatch is reported.
+ *
+ * @param[in] Copy_BDTR_Config  The break and dead-time configuration.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : BDTR written and read back as requested.
+ *   - E_NOT_OK : Dead-time out of range, invalid field, configuration already locked, or the lock level not taken
+ *                because BDTR had already been written since reset.
+ */
+Std_ReturnType GPT_TIM1_SetBreakDeadTime(const GPT_BDTR_Config_t* Copy_BDTR_Config);
+/**
+ * @brief Reports whether a break occurred since the last GPT_TIM1_ResumeOutputs.
+ *
+ * @param[out] Copy_BreakFlag   Receives 1 after a break (BIF), else 0.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Flag read.
+ *   - E_NOT_OK : NULL pointer.
+ */
+Std_ReturnType GPT_TIM1_GetBreakFlag(u8* Copy_BreakFlag);
+/**
+ * @brief Clears the break flag and enables the TIM1 outputs again (MOE).
+ *
+ * Needed after a break when automatic output is disabled. MOE cannot be set while the break input is still active.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Outputs enabled.
+ *   - E_NOT_OK : The break input is still active.
+ */
+Std_ReturnType GPT_TIM1_ResumeOutputs(void);
+/**
+ * @brief Reads the 32-bit encoder position.
+ *
+ * Safe from any context, including while the timer interrupt is masked: a wrap not yet counted by the interrupt is
+ * taken from the pending update flag.
+ *
+ * @param[in]  Copy_TIMx        TIM2, TIM3 or TIM4, started with GPT_Encoder_INIT.
+ * @param[out] Copy_Position    Receives the position in counts.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Position read.
+ *   - E_NOT_OK : Not an encoder timer, or NULL pointer.
+ */
+Std_ReturnType GPT_Encoder_GetPosition(u8 Copy_TIMx , s32* Copy_Position);
+/**
+ * @brief Sets the 32-bit encoder position (homing) and restarts the velocity measurement.
+ *
+ * @param[in] Copy_TIMx         TIM2, TIM3 or TIM4, started with GPT_Encoder_INIT.
+ * @param[in] Copy_Position     The new position in counts.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Position set.
+ *   - E_NOT_OK : Not an encoder timer.
+ */
+Std_ReturnType GPT_Encoder_SetPosition(u8 Copy_TIMx , s32 Copy_Position);
+/**
+ * @brief Estimates the encoder velocity; call it periodically (e.g. from the control loop).
+ *
+ * When at least GPT_ENCODER_LOW_SPEED_COUNTS counts passed since the last reference, the velocity is the count delta
+ * over the time since that reference (M method) and the edge interrupt is off. Below that, and with a timestamp timer,
+ * the TI1 capture interrupt is enabled; it collects the hardware-latched time and position of each TI1 edge, and the
+ * velocity is the count delta between two edges over the time between them (T method), free of interrupt latency
+ * and accurate down to a few counts per second. While no edge comes, the result is limited to one count over the time
+ * since the last edge, and drops to 0 after GPT_ENCODER_STOP_US.
+ *
+ * @param[in]  Copy_TIMx        TIM2, TIM3 or TIM4, started with GPT_Encoder_INIT.
+ * @param[out] Copy_Velocity    Receives the velocity in counts per second (negative when counting down).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Velocity updated.
+ *   - E_NOT_OK : Not an encoder timer, or NULL pointer.
+ */
+Std_ReturnType GPT_Encoder_GetVelocity(u8 Copy_TIMx , s32* Copy_Velocity);
+
+void TIM1_UP_IRQHandler (void);
+void TIM2_IRQHandler (void);
+void TIM3_IRQHandler (void);
+void TIM4_IRQHandler (void);
+
+
+
+
+
+#endif /* GPT_INTERFACE_H_ */
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @brief This module contains functions for configuring the Nested Vectored Interrupt Controller (NVIC).
+ *
+ * @author Mohamed Ali Bayoumi
+ * @date 20 OCT 2023
+ * @version V01
+ *
+ * This module provides functions for enabling and disabling interrupts, setting interrupt priorities, and other
+ * configuration options for the NVIC. It is designed to be used with ARM Cortex-M processors, and may not be
+ * compatible with other architectures.
+ *
+ * @note This module is intended for use with the STM32F10x microcontroller series, but may be adapted for use with
+ * other compatible processors.
+ */
+
+#ifndef MCAL_NVIC_CONFIG_H_
+#define MCAL_NVIC_CONFIG_H_
+/**
+ * @addtogroup User_Configuration
+ * @{
+ */
+
+/**
+ * @brief Total Number of Interrupts
+ *
+ * This macro defines the total number of interrupt sources in the system.
+ * It is a user-configurable setting and is used to dimension data structures
+ * related to interrupt handling.
+ */
+#define NUMBER_OF_INTERRUPTS    60
+/**
+ * @brief Maximum NVIC Interrupt Priority
+ *
+ * This macro defines the highest priority level that can be assigned to an
+ * interrupt in the Nested Vectored Interrupt Controller (NVIC). Interrupts
+ * with higher priority values have lower actual priorities. It is a
+ * user-configurable setting.
+ *
+ * @note This macro is intended for use with the MCAL_NVIC_xSetPriority function
+ *       which sets both group and sub-group priorities. If you are using the
+ *       MCAL_NVIC_vSetPriority function which sets group and sub-group priorities
+ *       separately, consider using the PRIORITY_GROUPING macro instead.
+ *
+ * @note The valid range for NVIC interrupt priorities is from 0 to (MAX_PRIORITY).
+ *       The highest priority is 0, and the value specified by this macro represents
+ *       the maximum numerical priority value achievable.
+ *
+ * @note The number of possible interrupts in the NVIC is (MAX_PRIORITY + 1).
+ */
+#define MAX_PRIORITY            15
+/**
+ * @brief Priority Grouping Options for NVIC (for MCAL_NVIC_vSetPriority)
+ *
+ * These macros define the available priority grouping options for the Nested
+ * Vectored Interrupt Controller (NVIC) when using the MCAL_NVIC_vSetPriority function.
+ * You can choose one of these options to configure how interrupt priorities are grouped.
+ *
+ * @attention These macros are intended for use with MCAL_NVIC_vSetPriority and should not
+ * be used with MCAL_NVIC_xSetPriority.
+ *
+ * - NVIC_16GROUP_0SUB:  16 subgroups with 0 bits for sub-priority.
+ *     - Group Priority Range: 0 to 15
+ *     - Sub-Priority Range: NVIC_INVALID_PRIORITY
+ * - NVIC_8GROUP_2SUB :  8 subgroups with 2 bits for sub-priority.
+ *     - Group Priority Range: 0 to 7
+ *     - Sub-Priority Range: 0 to 1
+ * - NVIC_4GROUP_4SUB :  4 subgroups with 4 bits for sub-priority.
+ *     - Group Priority Range: 0 to 3
+ *     - Sub-Priority Range: 0 to 3
+ * - NVIC_2GROUP_8SUB :  2 subgroups with 8 bits for sub-priority.
+ *     - Group Priority Range: 0 to 1
+ *     - Sub-Priority Range: 0 to 7
+ * - NVIC_0GROUP_16SUB:  No grouping with 16 bits for sub-priority.
+ *     - Group Priority Range: NVIC_INVALID_PRIORITY
+ *     - Sub-Priority Range: 0 to 15
+ */
+#define NVIC_PRIORITY_GROUPS    NVIC_4GROUP_4SUB
+/**
+ * @brief RAM Vector Table
+ *
+ * - NVIC_RAM_VECTORS_ENABLED : MCAL_NVIC_RelocateVectorTable copies the vector table into an aligned SRAM array and
+ *   points SCB_VTOR at it, after which MCAL_NVIC_AttachISR installs handlers directly in the table.
+ *   Costs (16 + NUMBER_OF_INTERRUPTS) * 4 bytes of SRAM, placed on a NVIC_RAM_VECTORS_ALIGNMENT boundary.
+ * - NVIC_RAM_VECTORS_DISABLED: the flash table is used as linked; the attach functions return E_NOT_OK.
+ */
+#define NVIC_RAM_VECTORS        NVIC_RAM_VECTORS_DISABLED
+/**
+ * @brief Interrupt Statistics
+ *
+ * - NVIC_IRQ_STATS_ENABLED : the EXTI, GPT and SysTick handlers time their own execution with the DWT cycle counter
+ *   and record count, last/min/max cycles and a log2 histogram of them for the sources listed in NVIC_STATS_SOURCES.
+ *   The entry latency before the handler starts is not measured.
+ * - NVIC_IRQ_STATS_DISABLED: the NVIC_STATS_ENTER / NVIC_STATS_EXIT hooks compile to nothing.
+ *
+ * NVIC_STATS_SOURCES lists the tracked IRQn numbers (NVIC_STATS_SYSTICK for the SysTick exception); each costs
+ * 48 bytes of SRAM. Sources not listed are ignored by the hooks.
+ *
+ * @note This file only holds macros, so the driver files include it (through NVIC_stats.h) to see the switch.
+ */
+#define NVIC_IRQ_STATS          NVIC_IRQ_STATS_DISABLED
+#define NVIC_STATS_SOURCES      { NVIC_EXTI0_IRQn , NVIC_EXTI1_IRQn , NVIC_EXTI2_IRQn , NVIC_EXTI3_IRQn , NVIC_EXTI4_IRQn ,  \
+                                  NVIC_EXTI9_5_IRQn , NVIC_EXTI15_10_IRQn , NVIC_TIM1_UP_IRQn , NVIC_TIM2_IRQn ,           \
+                                  NVIC_TIM3_IRQn , NVIC_TIM4_IRQn , NVIC_USART1_IRQn , NVIC_USART2_IRQn , NVIC_STATS_SYSTICK }
+
+/**
+ * @} User_Configuration
+ */
+#endif /* MCAL_NVIC_CONFIG_H_ */
\ No newline at end of file
@@ -0,0 +1,436 @@
+/**
+ * @brief This module contains functions for configuring the Nested Vectored Interrupt Controller (NVIC).
+ *
+ * @author Mohamed Ali Bayoumi
+ * @date 20 OCT 2023
+ * @version V01
+ *
+ * This module provides functions for enabling and disabling interrupts, setting interrupt priorities, and other
+ * configuration options for the NVIC. It is designed to be used with ARM Cortex-M processors, and may not be
+ * compatible with other architectures.
+ *
+ * @note This module is intended for use with the STM32F10x microcontroller series, but may be adapted for use with
+ * other compatible processors.
+ */
+#ifndef MCAL_NVIC_INTERFACE_H_
+#define MCAL_NVIC_INTERFACE_H_
+/**
+ * @defgroup NVIC_Types NVIC Type Definitions
+ * @brief Type definitions related to NVIC (Nested Vectored Interrupt Controller).
+ * @{
+ */
+
+/**
+ * @brief Type definition for Cortex-M microcontroller interrupt numbers.
+ *
+ * This typedef defines the data type for representing interrupt numbers in Cortex-M
+ * microcontroller architectures. Each interrupt is identified by a unique number,
+ * which is used when configuring interrupt priorities and enabling/disabling interrupts.
+ *
+ * The specific range and mapping of interrupt numbers can vary depending on the
+ * microcontroller model and vendor.
+ *
+ * @note The actual implementation may vary depending on the microcontroller architecture.
+ *       This typedef is often defined by the microcontroller's CMSIS (Cortex Microcontroller
+ *       Software Interface Standard) header file.
+ */
+typedef u8 IRQn_Type;
+/**
+ * @brief One entry of a priority table applied by MCAL_NVIC_ApplyPriorityTable.
+ */
+typedef struct
+{
+    IRQn_Type IRQn;     /**< Interrupt number                                                                     */
+    u8 Priority;        /**< Priority number 0 (most urgent) to MAX_PRIORITY, split into group/sub by the grouping */
+}NVIC_PriorityCfg_t;
+/**
+ * @brief Interrupt Execution-Time Statistics
+ * @{
+ */
+#define NVIC_IRQ_STATS_DISABLED     0
+#define NVIC_IRQ_STATS_ENABLED      1
+#define NVIC_STATS_SYSTICK          0xFF    /**< Source ID of the SysTick exception          */
+#define NVIC_STATS_EXEC_BINS        16      /**< Bin n counts runs of 2^n to 2^(n+1)-1 cycles; the last bin also holds longer runs */
+/**
+ * @brief Execution-time statistics of one interrupt source, in CPU cycles (SYSTEM_CLOCK_FREQUENCY).
+ *
+ * Every figure is the time the handler body ran, callbacks included. The entry latency (from the interrupt pending
+ * to the first instruction of the handler) is not measured.
+ */
+typedef struct
+{
+    u32 Count;                                  /**< Handler runs                          */
+    u32 LastExecCycles;                         /**< Execution time of the last run        */
+    u32 MinExecCycles;                          /**< Shortest run (0xFFFFFFFF before any)  */
+    u32 MaxExecCycles;                          /**< Longest run                           */
+    u16 ExecHistogram[NVIC_STATS_EXEC_BINS];    /**< log2 histogram of the execution times, saturating */
+}NVIC_IRQExecStats_t;
+/** @} */
+/**
+ * @brief Interrupt handler installed in the RAM vector table.
+ */
+typedef void (*NVIC_ISR_t)(void);
+/**
+ * @} (end of NVIC_Types NVIC Type Definitions)
+ */
+
+/**
+ * @defgroup NVIC_Interrupts NVIC Interrupt Numbers
+ * @brief Macros for NVIC interrupt numbers.
+ * @{
+ */
+
+/**
+ * @name Group 1 Interrupts
+ * @{
+ */
+#define NVIC_WWDG_IRQn               0   /**< WWDG Window Watchdog interrupt */
+#define NVIC_PVD_IRQn                1   /**< PVD PVD through EXTI Line detection interrupt */
+#define NVIC_TAMPER_IRQn             2   /**< TAMPER Tamper interrupt */
+#define NVIC_RTC_IRQn                3   /**< RTC RTC global interrupt */
+#define NVIC_FLASH_IRQn              4   /**< FLASH Flash global interrupt */
+#define NVIC_RCC_IRQn                5   /**< RCC RCC global interrupt */
+#define NVIC_EXTI0_IRQn              6   /**< EXTI0 EXTI Line0 interrupt */
+#define NVIC_EXTI1_IRQn              7   /**< EXTI1 EXTI Line1 interrupt */
+#define NVIC_EXTI2_IRQn              8   /**< EXTI2 EXTI Line2 interrupt */
+#define NVIC_EXTI3_IRQn              9   /**< EXTI3 EXTI Line3 interrupt */
+#define NVIC_EXTI4_IRQn              10  /**< EXTI4 EXTI Line4 interrupt */
+#define NVIC_DMA1_Channel1_IRQn      11  /**< DMA1_Channel1 DMA1 Channel1 global interrupt */
+#define NVIC_DMA1_Channel2_IRQn      12  /**< DMA1_Channel2 DMA1 Channel2 global interrupt */
+#define NVIC_DMA1_Channel3_IRQn      13  /**< DMA1_Channel3 DMA1 Channel3 global interrupt */
+#define NVIC_DMA1_Channel4_IRQn      14  /**< DMA1_Channel4 DMA1 Channel4 global interrupt */
+#define NVIC_DMA1_Channel5_IRQn      15  /**< DMA1_Channel5 DMA1 Channel5 global interrupt */
+#define NVIC_DMA1_Channel6_IRQn      16  /**< DMA1_Channel6 DMA1 Channel6 global interrupt */
+#define NVIC_DMA1_Channel7_IRQn      17  /**< DMA1_Channel7 DMA1 Channel7 global interrupt */
+#define NVIC_ADC1_2_IRQn             18  /**< ADC1_2 ADC1 and ADC2 global interrupt */
+#define NVIC_USB_HP_CAN_TX_IRQn      19  /**< CAN1_TX CAN1 TX interrupts */
+#define NVIC_USB_LP_CAN_RX_IRQ       20  /**< CAN1_RX0 CAN1 RX0 interrupts */
+#define NVIC_CAN1_RX1_IRQn           21  /**< CAN1_RX1 CAN1 RX1 interrupt */
+#define NVIC_CAN1_SCE_IRQn           22  /**< CAN1_SCE CAN1 SCE interrupt */
+#define NVIC_EXTI9_5_IRQn            23  /**< EXTI9_5 EXTI Line[9:5] interrupts */
+#define NVIC_TIM1_BRK_IRQn           24  /**< TIM1_BRK TIM1 Break interrupt */
+#define NVIC_TIM1_UP_IRQn            25  /**< TIM1_UP TIM1 Update interrupt */
+#define NVIC_TIM1_TRG_COM_IRQn       26  /**< TIM1_TRG_COM TIM1 Trigger and Commutation interrupts */
+#define NVIC_TIM1_CC_IRQn            27  /**< TIM1_CC TIM1 Capture Compare interrupt */
+#define NVIC_TIM2_IRQn               28  /**< TIM2 TIM2 global interrupt */
+#define NVIC_TIM3_IRQn               29  /**< TIM3 TIM3 global interrupt */
+#define NVIC_TIM4_IRQn               30  /**< TIM4 TIM4 global interrupt */
+#define NVIC_I2C1_EV_IRQn            31  /**< I2C1_EV I2C1 event interrupt */
+/** @} */
+
+/**
+ * @name Group 2 Interrupts
+ * @{
+ */
+#define NVIC_I2C1_ER_IRQn            32  /**< I2C1_ER I2C1 error interrupt */
+#define NVIC_I2C2_EV_IRQn            33  /**< I2C2_EV I2C2 event interrupt */
+#define NVIC_I2C2_ER_IRQn            34  /**< I2C2_ER I2C2 error interrupt */
+#define NVIC_SPI1_IRQn               35  /**< SPI1 SPI1 global interrupt */
+#define NVIC_SPI2_IRQn               36  /**< SPI2 SPI2 global interrupt */
+#define NVIC_USART1_IRQn             37  /**< USART1 USART1 global interrupt */
+#define NVIC_USART2_IRQn             38  /**< USART2 USART2 global interrupt */
+#define NVIC_USART3_IRQn             39  /**< USART3 USART3 global interrupt */
+#define NVIC_EXTI15_10_IRQn          40  /**< EXTI15_10 EXTI Line[15:10] interrupts */
+#define NVIC_RTCAlarm_IRQn           41  /**< RTCAlarm RTC alarm through EXTI line interrupt */
+#define NVIC_USB_WKUP_IRQn           42  /**< USB_WKUP USB On-The-Go FS Wakeup through EXTI line interrupt */
+#define NVIC_TIM8_BRK_IRQn           43  /**< Reserved interrupt */
+#define NVIC_TIM8_UP_IRQn            44  /**< Reserved interrupt */
+#define NVIC_TIM8_TRG_COM_IRQn       45  /**< Reserved interrupt */
+#define NVIC_TIM8_CC_IRQn            46  /**< Reserved interrupt */
+#define NVIC_ADC3_IRQn               47  /**< TIM5 TIM5 global interrupt */
+#define NVIC_FSMC_IRQn               48  /**< SPI3 SPI3 global interrupt */
+#define NVIC_SDIO_IRQn               49  /**< UART4 UART4 global interrupt */
+#define NVIC_TIM5_IRQn               50  /**< UART5 UART5 global interrupt */
+#define NVIC_SPI3_IRQn               51  /**< TIM6 TIM6 global interrupt */
+#define NVIC_UART4_IRQn              52  /**< TIM7 TIM7 global interrupt */
+#define NVIC_UART5_IRQn              53  /**< DMA2_Channel1 DMA2 Channel1 global interrupt */
+#define NVIC_TIM6_IRQn               54  /**< DMA2_Channel2 DMA2 Channel2 global interrupt */
+#define NVIC_TIM7_IRQn               55  /**< DMA2_Channel3 DMA2 Channel3 global interrupt */
+#define NVIC_DMA2_CHANNEL1_IRQn      56  /**< DMA2_Channel4 DMA2 Channel4 global interrupt */
+#define NVIC_DMA2_CHANNEL2_IRQn      57  /**< DMA2_Channel5 DMA2 Channel5 global interrupt */
+#define NVIC_DMA2_CHANNEL3_IRQn      58  /**< ETH Ethernet global interrupt */
+#define NVIC_DMA2_CHANNEL4_5_IRQn    59  /**< ETH_WKUP Ethernet Wakeup through EXTI line interrupt */
+
+
+/**
+ * @} (end of NVIC_Interrupts NVIC Interrupt Numbers)
+ */
+         
+/**
+ * @defgroup NVIC_Control NVIC Control Functions
+ * @brief Functions to control the Nested Vectored Interrupt Controller (NVIC).
+ * @{
+ */
+
+/**
+ * @brief Enable a specific interrupt in the NVIC.
+ *
+ * This function enables the specified interrupt in the NVIC.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type) to enable.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Interrupt enabled successfully.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number).
+ */
+
+Std_ReturnType MCAL_NVIC_EnableIRQ(IRQn_Type Copy_IRQn);
+/**
+ * @brief Disable a specific interrupt in the NVIC.
+ *
+ * This function disables the specified interrupt in the NVIC.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type) to disable.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Interrupt disabled successfully.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number).
+ */
+Std_ReturnType MCAL_NVIC_DisableIRQ(IRQn_Type Copy_IRQn);
+/**
+ * @brief Set a specific interrupt as pending in the NVIC.
+ *
+ * This function sets the specified interrupt as pending in the NVIC.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type) to set as pending.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Interrupt set as pending successfully.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number).
+ */
+Std_ReturnType MCAL_NVIC_SetPendingIRQ(IRQn_Type Copy_IRQn);
+/**
+ * @brief Clear the pending status of a specific interrupt in the NVIC.
+ *
+ * This function clears the pending status of the specified interrupt in the NVIC.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type) to clear as pending.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Pending status cleared successfully.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number).
+ */
+Std_ReturnType MCAL_NVIC_ClearPendingIRQ(IRQn_Type Copy_IRQn);
+/**
+ * @brief Get the pending status of a specific interrupt in the NVIC.
+ *
+ * This function checks if the specified interrupt is pending in the NVIC.
+ *
+ * @param[in]  Copy_IRQn            The interrupt number (IRQn_Type) to check.
+ * @param[out] PendingIRQ Pointer to a variable where the pending status will be stored.
+ *                                  This will be set to 1 if the interrupt is pending, or 0 if it's not.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Interrupt is pending, and the pending status is returned in 'Copy_ReturnPendingFlag'.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number), and 'Copy_ReturnPendingFlag' is not modified.
+ */
+Std_ReturnType MCAL_NVIC_GetPendingIRQ(IRQn_Type Copy_IRQn , u8* PendingIRQ);
+/**
+ * @brief Get the active status of a specific interrupt in the NVIC.
+ *
+ * This function checks if the specified interrupt is active in the NVIC.
+ *
+ * @param[in]  Copy_IRQn            The interrupt number (IRQn_Type) to check.
+ * @param[out] ActiveIRQ Pointer to a variable where the active status will be stored.
+ *                                  This will be set to 1 if the interrupt is active, or 0 if it's not.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Interrupt is avtive, and the active status is returned in 'Copy_ReturnActiveFlag'.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number), and 'Copy_ReturnActiveFlag' is not modified.
+ */
+Std_ReturnType MCAL_NVIC_GetActiveIRQ(IRQn_Type Copy_IRQn , u8* ActiveIRQ);
+/**
+ * @brief Set the priority of a specific interrupt in the NVIC.
+ *
+ * This function sets the priority of the specified interrupt in the NVIC.
+ *
+ * @param[in] Copy_IRQn     The interrupt number (IRQn_Type) to set the priority for.
+ * @param[in] Copy_Priority The priority level to set (0 to 15, with 0 being the highest).
+ *
+ * The 4-bit priority is split into group and sub-priority by NVIC_PRIORITY_GROUPS (NVIC_config.h), which is applied.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Priority set successfully.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number or priority level).
+ */
+Std_ReturnType MCAL_NVIC_xSetPriority(IRQn_Type Copy_IRQn , u32 Copy_Priority);
+/**
+ * @brief Set the priority of a specific interrupt in the NVIC.
+ *
+ * This function sets the priority of the specified interrupt in the NVIC.
+ *
+ * @param[in] Copy_IRQn         The interrupt number (IRQn_Type) to set the priority for.
+ * @param[in] Copy_GroupPriority The group priority level (0 to 7, with 0 being the highest).
+ * @param[in] Copy_SubPriority  The sub-priority level within the group (0 to 1, 2, or 3, depending on the chosen PRIORITY_GROUPING).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Priority set successfully.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number or priority levels).
+ *
+ * @details
+ * This function allows you to set the priority of a specific interrupt in the Nested Vectored Interrupt Controller (NVIC).
+ * The priority levels must be within the valid range for your system and should respect the selected PRIORITY_GROUPING.
+ *
+ * @note When using PRIORITY_GROUPING equal to NVIC_16GROUP_0SUB or NVIC_0GROUP_16SUB:
+ *   - Copy_SubPriority should be 0.
+ *   - Copy_GroupPriority should be in the range [0, 15] for NVIC_16GROUP_0SUB and NONE for NVIC_0GROUP_16SUB.
+ *
+ * @note When using other PRIORITY_GROUPING options (NVIC_8GROUP_2SUB, NVIC_4GROUP_4SUB, or NVIC_2GROUP_8SUB):
+ *   - Copy_SubPriority can be in the range [0, 3].
+ *   - Copy_GroupPriority can be in the range [0, 7].
+ *
+ * @see NVIC_config.h for details on PRIORITY_GROUPING.
+ */
+Std_ReturnType MCAL_NVIC_vSetPriority(IRQn_Type Copy_IRQn , u8 Copy_GroupPriority , u8 Copy_SubPriority );
+
+/**
+ * @brief Get the priority of a specific interrupt in the NVIC.
+ *
+ * This function retrieves the priority of the specified interrupt in the NVIC.
+ *
+ * @param[in]  IRQn            The interrupt number (IRQn_Type) to get the priority for.
+ * @param[out] Copy_Priority   A pointer to a variable that will store the retrieved priority.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Priority retrieved successfully, and the value is stored in Copy_Priority.
+ *   - E_NOT_OK : An error occurred (invalid interrupt number or Copy_Priority pointer is NULL).
+ */
+Std_ReturnType MCAL_NVIC_GetPriority(IRQn_Type Copy_IRQn , u8* Priority);
+/**
+ * @brief Sets the priorities of several interrupts from a table, typically a const table in flash.
+ *
+ * Every entry is checked first; if one is invalid nothing is written. Each priority is then stored into its own 8-bit
+ * IPR field, leaving the other interrupts untouched. The priority grouping is set from NVIC_PRIORITY_GROUPS.
+ *
+ * @param[in] Copy_Table Table of {IRQn, Priority} entries.
+ * @param[in] Copy_Count Number of entries.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : All priorities set.
+ *   - E_NOT_OK : NULL table, or an entry with an invalid interrupt number or a priority above MAX_PRIORITY.
+ *
+ * @code
+ * static const NVIC_PriorityCfg_t App_Priorities[] =
+ * {
+ *     { NVIC_TIM1_UP_IRQn , 0 },  /// motor control, above the SCB_CRITICAL_CEILING
+ *     { NVIC_EXTI0_IRQn   , 8 },
+ *     { NVIC_USART1_IRQn  , 12 },
+ * };
+ * MCAL_NVIC_ApplyPriorityTable(App_Priorities, sizeof(App_Priorities) / sizeof(App_Priorities[0]));
+ * @endcode
+ */
+Std_ReturnType MCAL_NVIC_ApplyPriorityTable(const NVIC_PriorityCfg_t *Copy_Table , u8 Copy_Count);
+/**
+ * @brief Starts the DWT cycle counter and clears the statistics of every source in NVIC_STATS_SOURCES.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Statistics running.
+ *   - E_NOT_OK : NVIC_IRQ_STATS is NVIC_IRQ_STATS_DISABLED, or NVIC_STATS_SOURCES holds an invalid source.
+ */
+Std_ReturnType MCAL_NVIC_StatsInit(void);
+/**
+ * @brief Records the execution time of one handler run; called by NVIC_STATS_EXIT (see NVIC_stats.h), not by the application.
+ *
+ * @param[in] Copy_SourceID IRQn, or NVIC_STATS_SYSTICK.
+ * @param[in] Copy_Cycles Execution time of the run in cycles.
+ */
+void MCAL_NVIC_StatsRecordExec(u8 Copy_SourceID , u32 Copy_Cycles);
+/**
+ * @brief Reads the execution-time statistics of one source.
+ *
+ * The copy is not atomic against the handler of that source; read it again if Count changed meanwhile.
+ *
+ * @param[in] Copy_SourceID IRQn, or NVIC_STATS_SYSTICK.
+ * @param[out] Copy_Stats Receives the statistics.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Statistics copied.
+ *   - E_NOT_OK : Source not tracked, NULL pointer, or statistics disabled.
+ */
+Std_ReturnType MCAL_NVIC_GetExecStats(u8 Copy_SourceID , NVIC_IRQExecStats_t *Copy_Stats);
+/**
+ * @brief Clears the execution-time statistics of every tracked source.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Statistics cleared.
+ *   - E_NOT_OK : Statistics disabled.
+ */
+Std_ReturnType MCAL_NVIC_ResetExecStats(void);
+/**
+ * @brief Serializes the execution-time statistics of every tracked source into a compact binary record, e.g. to send over USART.
+ *
+ * Format (little endian): 0x53 'S', 0x54 'T', record count (u8), bin count (u8), then per source:
+ * IRQn (u8, 0xFF = SysTick) | Count | LastExecCycles | MinExecCycles | MaxExecCycles (u32 each) | ExecHistogram (u16 per bin).
+ *
+ * @param[out] Copy_Buffer Receives the dump.
+ * @param[in] Copy_BufferSize Size of Copy_Buffer in bytes.
+ * @param[out] Copy_Length Receives the number of bytes written.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Dump written.
+ *   - E_NOT_OK : NULL pointer, buffer too small, or statistics disabled.
+ */
+Std_ReturnType MCAL_NVIC_DumpExecStats(u8 *Copy_Buffer , u16 Copy_BufferSize , u16 *Copy_Length);
+/**
+ * @brief Moves the vector table to SRAM.
+ *
+ * Copies the active table (stack pointer, system exceptions and the NUMBER_OF_INTERRUPTS IRQ vectors) to an aligned
+ * SRAM array and points SCB_VTOR at it, so the handlers already linked keep working. Empty IRQ slots, and IRQ slots
+ * still pointing at the startup file's Default_Handler loop, get the default handler, which disables and records a
+ * stray interrupt instead of hanging. The system exception vectors are copied as they are. Calling it again once
+ * relocated does nothing.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : The table is in SRAM.
+ *   - E_NOT_OK : NVIC_RAM_VECTORS is NVIC_RAM_VECTORS_DISABLED in NVIC_config.h.
+ */
+Std_ReturnType MCAL_NVIC_RelocateVectorTable(void);
+/**
+ * @brief Installs a handler directly in the RAM vector table.
+ *
+ * The core then branches straight to Copy_ISR on the interrupt, without a driver handler calling a stored callback,
+ * saving a call, a stack frame and a pointer load per interrupt. The handler replaces the driver's one for that
+ * vector, so it must clear the peripheral's flags itself.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type).
+ * @param[in] Copy_ISR  The handler; NULL installs the default handler.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Handler installed.
+ *   - E_NOT_OK : Invalid interrupt number, table not relocated, or RAM vectors disabled.
+ *
+ * @code
+ * MCAL_NVIC_RelocateVectorTable();
+ * MCAL_NVIC_AttachISR(NVIC_TIM2_IRQn, MotorControl_ISR);
+ * MCAL_NVIC_EnableIRQ(NVIC_TIM2_IRQn);
+ * @endcode
+ */
+Std_ReturnType MCAL_NVIC_AttachISR(IRQn_Type Copy_IRQn , NVIC_ISR_t Copy_ISR);
+/**
+ * @brief Puts the default handler back on a vector.
+ *
+ * The default handler disables the interrupt that entered it (so an unserved level-triggered source cannot lock the
+ * core up) and records it; see MCAL_NVIC_GetUnhandledIRQ.
+ *
+ * @param[in] Copy_IRQn The interrupt number (IRQn_Type).
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Default handler installed.
+ *   - E_NOT_OK : Invalid interrupt number, table not relocated, or RAM vectors disabled.
+ */
+Std_ReturnType MCAL_NVIC_DetachISR(IRQn_Type Copy_IRQn);
+/**
+ * @brief Reports interrupts that reached the default handler.
+ *
+ * @param[out] Copy_LastIRQn Receives the last interrupt number served by the default handler.
+ * @param[out] Copy_Count    Receives how many times the default handler ran.
+ *
+ * @return Std_ReturnType
+ *   - E_OK     : Values read.
+ *   - E_NOT_OK : NULL pointer, or RAM vectors disabled.
+ */
+Std_ReturnType MCAL_NVIC_GetUnhandledIRQ(IRQn_Type *Copy_LastIRQn , u32 *Copy_Count);
+
+
+
+#endif /* MCAL_NVIC_INTERFACE_H_ */
@@ -0,0 +1,121 @@
+/**
+ * @brief This module contains functions for configuring the Nested Vectored Interrupt Controller (NVIC).
+ *
+ * @author Mohamed Ali Bayoumi
+ * @date 20 OCT 2023
+ * @version V01
+ *
+ * This module provides functions for enabling and disabling interrupts, setting interrupt priorities, and other
+ * configuration options for the NVIC. It is designed to be used with ARM Cortex-M processors, and may not be
+ * compatible with other architectures.
+ *
+ * @note This module is intended for use with the STM32F10x microcontroller series, but may be adapted for use with
+ * other compatible processors.
+ */
+
+#ifndef MCAL_NVIC_PRIVATE_H_
+#define MCAL_NVIC_PRIVATE_H_
+/**
+ * @defgroup NVIC_Registers NVIC Registers
+ * @brief NVIC (Nested Vectored Interrupt Controller) Registers.
+ * @{
+ */
+#define NVIC_BASE_ADDRESS   0xE000E100
+
+/**
+ * @brief NVIC ISER Registers.
+ * @{
+ */
+#define NVIC_ISER0              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x000))))
+#define NVIC_ISER1              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x004))))
+#define NVIC_ISER2              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x008))))
+/**
+ * @brief NVIC ICER Registers.
+ * @{
+ */
+#define NVIC_ICER0              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x080))))
+#define NVIC_ICER1              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x084))))
+#define NVIC_ICER2              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x088))))
+/**
+ * @brief NVIC ISPR Registers.
+ * @{
+ */
+#define NVIC_ISPR0              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x100))))
+#define NVIC_ISPR1              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x104))))
+#define NVIC_ISPR2              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x108))))
+/**
+ * @brief NVIC ICPR Registers.
+ * @{
+ */
+#define NVIC_ICPR0              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x180))))
+#define NVIC_ICPR1              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x184))))
+#define NVIC_ICPR2              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x188))))
+/**
+ * @brief NVIC IABR Registers.
+ * @{
+ */
+#define NVIC_IABR0              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x200))))
+#define NVIC_IABR1              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x204))))
+#define NVIC_IABR2              (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x208))))
+/** @} */
+
+/**
+ * @brief NVIC IPR Base Address
+ */     
+#define NVIC_IPR_Base_Address   (((volatile u32 *)((NVIC_BASE_ADDRESS) + (0x300))))
+/**
+ * @brief NVIC IPR byte access: one 8-bit priority field per interrupt, so a store never touches the neighbours
+ */
+#define NVIC_IPR_BYTE(IRQn)     (((volatile u8 *)((NVIC_BASE_ADDRESS) + (0x300)))[(IRQn)])
+/**
+ * @brief Implemented priority bits (upper 4 bits of each field)
+ */
+#define NVIC_PRIORITY_SHIFT     4
+/**
+ * @brief NVIC STIR Base Address
+ */  
+#define NVIC_STIR               (*((volatile u32 *)((NVIC_BASE_ADDRESS) + (0xE00))))
+/**
+ * @brief Priority Grouping Values
+ * @{
+ */
+#define NVIC_16GROUP_0SUB       0x05FA0300U 
+#define NVIC_8GROUP_2SUB        0x05FA0400U 
+#define NVIC_4GROUP_4SUB        0x05FA0500U 
+#define NVIC_2GROUP_8SUB        0x05FA0600U 
+#define NVIC_0GROUP_16SUB       0x05FA0700U 
+/**
+ * @brief Distance between two group priorities in 4-bit priority numbers (PRIGROUP 3 -> 1 .. PRIGROUP 7 -> 16)
+ */
+#define NVIC_GROUP_STEP(GROUPING)   (1 << ((((GROUPING) >> 8) & 0x7) - 3))
+
+/**
+ * @brief RAM Vector Table
+ * @{
+ */
+#define NVIC_RAM_VECTORS_DISABLED   0
+#define NVIC_RAM_VECTORS_ENABLED    1
+/**< Stack pointer, reset and the 14 system exception slots precede the IRQ vectors */
+#define NVIC_CORE_VECTORS           16
+#define NVIC_VECTORS_COUNT          (NVIC_CORE_VECTORS + NUMBER_OF_INTERRUPTS)
+/**< VTOR needs the table aligned to its size rounded up to a power of two: 76 vectors * 4 bytes -> 512 */
+#define NVIC_RAM_VECTORS_ALIGNMENT  512
+/** @} */
+
+/**
+ * @brief Interrupt Statistics
+ * @{
+ */
+/**< Slot of the SysTick exception in the source map, after the IRQs */
+#define NVIC_STATS_MAP_SIZE         (NUMBER_OF_INTERRUPTS + 1)
+/**< Binary dump: 'S' 'T' | record count | bin count, then per record IRQn (u8), Count, Last, Min, Max (u32) and bins (u16) */
+#define NVIC_STATS_DUMP_SYNC0       0x53
+#define NVIC_STATS_DUMP_SYNC1       0x54
+#define NVIC_STATS_DUMP_HEADER      4
+#define NVIC_STATS_DUMP_RECORD      (1 + (4 * 4) + (NVIC_STATS_EXEC_BINS * 2))
+/** @} */
+
+/**
+ * @} (end of group NVIC_Registers)
+ */
+#endif /* MCAL_NVIC_PRIVATE_H_ */
\ No newline at end of file
@@ -0,0 +1,32 @@
+/**
+ **********************************************************************************************************************************
+ * @brief Execution-time statistics hooks for the driver interrupt handlers.
+ *
+ * @version V01
+ ***********************************************************************************************************************************
+ * A handler opens with NVIC_STATS_ENTER(), which latches the DWT cycle counter, and closes with
+ * NVIC_STATS_EXIT(IRQn), which hands the elapsed cycles to MCAL_NVIC_StatsRecordExec. With NVIC_IRQ_STATS disabled in
+ * NVIC_config.h both hooks expand to nothing, so the handlers are exactly as fast as without instrumentation.
+ *
+ * The measured span is from the first instruction of the handler body to its end, callbacks included; the hardware
+ * stacking and the tail of the exception return are not part of it, and neither is the latency before entry.
+ **********************************************************************************************************************************
+ */
+#ifndef MCAL_NVIC_STATS_H_
+#define MCAL_NVIC_STATS_H_
+
+#include "SCB_interface.h"
+#include "NVIC_interface.h"
+#include "NVIC_config.h"
+
+#if NVIC_IRQ_STATS == NVIC_IRQ_STATS_ENABLED
+#define NVIC_STATS_ENTER()          u32 NVIC_StatsEntryCycles = SCB_DWT_CYCCNT
+#define NVIC_STATS_EXIT(SOURCE)     MCAL_NVIC_StatsRecordExec( (SOURCE) , SCB_DWT_CYCCNT - NVIC_StatsEntryCycles )
+#elif NVIC_IRQ_STATS == NVIC_IRQ_STATS_DISABLED
+#define NVIC_STATS_ENTER()          do{ }while(0)
+#define NVIC_STATS_EXIT(SOURCE)     do{ }while(0)
+#else
+    #error "Wrong NVIC_IRQ_STATS configuration"
+#endif
+
+#endif /* MCAL_NVIC_STATS_H_ */
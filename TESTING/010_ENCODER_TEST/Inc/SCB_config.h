@@ -0,0 +1,61 @@
+/****************************************************************/
+/******* Author    : Mohamed Ali Bayoumi        *****************/
+/******* Date      : 21 OCT 2023                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SCB_config.h               *****************/
+/****************************************************************/
+#ifndef SCB_CONFIG_H_
+#define SCB_CONFIG_H_
+/**
+ * @brief Priority ceiling of MCAL_SCB_EnterCritical (1 to 15).
+ *
+ * Inside a critical section every interrupt whose priority number is >= SCB_CRITICAL_CEILING is held off; interrupts
+ * with a smaller number (more urgent, e.g. a motor control timer) keep running and must not touch driver state.
+ * BASEPRI only compares group priorities, so the ceiling must be a whole group of NVIC_PRIORITY_GROUPS (e.g. a multiple
+ * of 4 with NVIC_4GROUP_4SUB); NVIC_program.c rejects other values.
+ */
+#define SCB_CRITICAL_CEILING    4
+/**
+ * @brief Deferred work queue (ISR bottom halves run from PendSV).
+ *
+ * SCB_DEFERRED_MODE:
+ * - SCB_DEFERRED_ENABLED : this driver owns PendSV_Handler; MCAL_SCB_PostDeferred queues {function, argument} items
+ *   that run in order at the lowest interrupt priority. Do not enable together with an RTOS that uses PendSV.
+ * - SCB_DEFERRED_DISABLED: posting fails, so drivers asked to defer a callback run it immediately instead.
+ *
+ * SCB_DEFERRED_QUEUE_SIZE: items that can wait at once, a power of two in 2..256 (16 bytes each).
+ */
+#define SCB_DEFERRED_MODE       SCB_DEFERRED_DISABLED
+#define SCB_DEFERRED_QUEUE_SIZE 16
+/**
+ * @brief Event-driven idle for blocking driver waits.
+ *
+ * SCB_IDLE_MODE:
+ * - SCB_IDLE_ENABLED : after MCAL_SCB_InitIdle, the SysTick delays, GPT_TIMx_SetBusyWait and the USART polling calls
+ *   sleep in WFE between checks of their flag instead of spinning, and the cycles spent asleep are counted
+ *   (MCAL_SCB_GetIdleStats). To keep a debugger attached while the core sleeps set DBG_SLEEP in DBGMCU_CR.
+ * - SCB_IDLE_DISABLED: waits spin as before; MCAL_SCB_WaitForInterrupt / WaitForEvent still sleep but are not counted.
+ */
+#define SCB_IDLE_MODE           SCB_IDLE_DISABLED
+/**
+ * @brief Cycles MCAL_SCB_DelayCycles spends outside its wait loop (call, checks, return), subtracted from every delay.
+ *
+ * Only a starting estimate: MCAL_SCB_InitDelay measures the real value for the compiler and flash wait states in use.
+ */
+#define SCB_DELAY_OVERHEAD_CYCLES   12
+/**
+ * @brief Reset service: reset cause, software reset reason and a RAM block kept across warm resets.
+ *
+ * SCB_RESET_SERVICE: SCB_RESET_SERVICE_ENABLED or SCB_RESET_SERVICE_DISABLED.
+ *
+ * SCB_NOINIT_SECTION: section of the block. The start-up code must neither copy nor zero it, so the linker script
+ * needs it as a NOLOAD output section in RAM, e.g.
+ *     .noinit (NOLOAD) : { . = ALIGN(4); *(.noinit) . = ALIGN(4); } >RAM
+ *
+ * SCB_NOINIT_USER_WORDS: application words kept in the block (calibration data ...), 1..64.
+ */
+#define SCB_RESET_SERVICE       SCB_RESET_SERVICE_DISABLED
+#define SCB_NOINIT_SECTION      ".noinit"
+#define SCB_NOINIT_USER_WORDS   8
+
+#endif /* SCB_CONFIG_H_ */
\ No newline at end of file
@@ -0,0 +1,71 @@
+/****************************************************************/
+/******* Author    : Mohamed Ali Bayoumi        *****************/
+/******* Date      : 21 OCT 2023                *****************/
+/******* Version   : 0.1                        *****************/
+/******* File Name : SCB_private.h              *****************/
+/****************************************************************/
+
+#ifndef SCB_PRIVATE_H_
+#define SCB_PRIVATE_H_
+/**< Base address of the SCB registers */
+
+#define SCB_BASE_ADDRESS        0xE000ED00
+
+/**< SCB Registers */
+
+#define SCB_ACTLR           (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x00))))
+#define SCB_CPUID           (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x00))))
+#define SCB_ICSR            (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x04))))
+#define SCB_VTOR            (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x08))))
+#define SCB_AIRCR           (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x0C))))
+#define SCB_SCR             (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x10))))
+#define SCB_CCR             (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x14))))
+#define SCB_SHPR1           (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x18))))
+#define SCB_SHPR2           (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x1C))))
+#define SCB_SHPR3           (*((volatile u32 *)(0xE000ED20)))
+#define SCB_SHCSR           (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x24))))
+#define SCB_CFSR            (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x28))))
+#define SCB_HFSR            (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x2C))))
+#define SCB_MMFAR           (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x34))))
+#define SCB_BFAR            (*((volatile u32 *)((SCB_BASE_ADDRESS) + (0x38))))
+/**< Bit positions for SCB_SHCSR register */
+
+#define SCB_SHCSR_MEMFAULTENA_POS    16  /**< Bit position for Memory Management Fault Enable */
+#define SCB_SHCSR_BUSFAULTENA_POS    17  /**< Bit position for Bus Fault Enable */
+#define SCB_SHCSR_USGFAULTENA_POS    18  /**< Bit position for Usage Fault Enable */
+
+/**< SCB_VTOR: TBLOFF occupies bits 7..29, bit 29 selects SRAM */
+#define SCB_VTOR_TBLOFF_MASK         0x3FFFFF80
+
+/**< Implemented priority bits: the STM32F10x uses the upper 4 bits of each 8-bit priority field */
+#define SCB_PRIORITY_SHIFT           4
+
+/**< SCB_ICSR: pend the PendSV exception */
+#define SCB_ICSR_PENDSVSET_POS       28
+/**< 8-bit priority field of system handler N (4 = MemManage ... 14 = PendSV, 15 = SysTick) */
+#define SCB_SHPR_BYTE(HANDLER)       (((volatile u8 *)(0xE000ED18))[(HANDLER) - 4])
+#define SCB_PENDSV_HANDLER           14
+#define SCB_LOWEST_PRIORITY          0xF0
+/**< Deferred work queue */
+#define SCB_DEFERRED_DISABLED        0
+#define SCB_DEFERRED_ENABLED         1
+
+/**< SCB_SCR: low-power control */
+#define SCB_SCR_SLEEPONEXIT_POS      1
+#define SCB_SCR_SEVONPEND_POS        4
+/**< Delay requested by MCAL_SCB_InitDelay to measure the overhead of MCAL_SCB_DelayCycles */
+#define SCB_DELAY_CALIBRATION_CYCLES 1000
+/**< Idle mode */
+#define SCB_IDLE_DISABLED            0
+#define SCB_IDLE_ENABLED             1
+
+/**< SCB_AIRCR: write key, priority grouping field and system reset request */
+#define SCB_AIRCR_VECTKEY            0x05FA0000
+#define SCB_AIRCR_PRIGROUP_MASK      0x00000700
+#define SCB_AIRCR_SYSRESETREQ_POS    2
+/**< Reset service */
+#define SCB_RESET_SERVICE_DISABLED   0
+#define SCB_RESET_SERVICE_ENABLED    1
+#define SCB_NOINIT_MAGIC             0x5741524D   /* "WARM" */
+
+#endif /* SCB_PRIVATE_H_ */
\ No newline at end of file
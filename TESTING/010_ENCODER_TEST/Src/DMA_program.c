@@ -0,0 +1,239 @@
+/**
+ * @brief Implementation of the DMA1 driver.
+ *
+ * A channel is disabled before it is reconfigured, as its registers are only writable while EN is clear. The channel
+ * interrupts latch and clear their flags with one IFCR write, then run the callbacks, error first; each callback can
+ * also be deferred to the SCB work queue.
+ *
+ * @version V01
+ */
+/**************************************** LIB ******************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**************************************** MCAL *****************************************************/
+/**< SCB */
+#include "SCB_interface.h"
+/**< DMA */
+#include "DMA_interface.h"
+#include "DMA_private.h"
+#include "DMA_config.h"
+/**************************************** Global Variables Section *****************************************************/
+static DMA_CallbackFunc_t DMA_Callback[DMA_CHANNELS_COUNT][DMA_EVENTS_COUNT] = {{NULL}};
+/* Bit n set: the callbacks of channel n are posted to the PendSV work queue */
+static u8 DMA_DeferredChannels = 0;
+/**************************************** Static Functions Section *****************************************************/
+static void DMA_voidChannelHandler(u8 Copy_Channel);
+static void DMA_voidRunCallback(u8 Copy_Channel , u8 Copy_Event);
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_DMA_InitChannel(u8 Copy_Channel , const DMA_ChannelConfig_t *Copy_Config)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u32 Local_CCR = 0;
+    if ( (Copy_Channel < DMA_CHANNELS_COUNT) && (Copy_Config != NULL) && (Copy_Config->Count != 0) &&
+         (Copy_Config->Direction <= DMA_DIR_MEM_TO_PERIPH) && (Copy_Config->PeripheralSize <= DMA_SIZE_32BIT) &&
+         (Copy_Config->MemorySize <= DMA_SIZE_32BIT) && (Copy_Config->PeripheralInc <= DMA_INC_ENABLE) &&
+         (Copy_Config->MemoryInc <= DMA_INC_ENABLE) && (Copy_Config->Mode <= DMA_MODE_CIRCULAR) &&
+         (Copy_Config->Priority <= DMA_PRIORITY_VERY_HIGH) )
+    {
+        /* Build the whole CCR first so the channel register is written once */
+        Local_CCR = ( (u32)(Copy_Config->Interrupts & (DMA_INT_TRANSFER_COMPLETE | DMA_INT_HALF_TRANSFER | DMA_INT_TRANSFER_ERROR)) ) |
+                    ( (u32)Copy_Config->Direction      << DMA_CCR_DIR   ) |
+                    ( (u32)Copy_Config->Mode           << DMA_CCR_CIRC  ) |
+                    ( (u32)Copy_Config->PeripheralInc  << DMA_CCR_PINC  ) |
+                    ( (u32)Copy_Config->MemoryInc      << DMA_CCR_MINC  ) |
+                    ( (u32)Copy_Config->PeripheralSize << DMA_CCR_PSIZE ) |
+                    ( (u32)Copy_Config->MemorySize     << DMA_CCR_MSIZE ) |
+                    ( (u32)Copy_Config->Priority       << DMA_CCR_PL    );
+        /* CPAR/CMAR/CNDTR are only writable while the channel is disabled */
+        DMA1->CH[Copy_Channel].CCR = 0;
+        DMA1->IFCR = ( (u32)DMA_ISR_CHANNEL_MASK << DMA_ISR_CHANNEL_SHIFT(Copy_Channel) );
+        DMA1->CH[Copy_Channel].CPAR = Copy_Config->PeripheralAddress;
+        DMA1->CH[Copy_Channel].CMAR = Copy_Config->MemoryAddress;
+        DMA1->CH[Copy_Channel].CNDTR = Copy_Config->Count;
+        DMA1->CH[Copy_Channel].CCR = Local_CCR;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_DMA_SetTransfer(u8 Copy_Channel , u32 Copy_PeripheralAddress , u32 Copy_MemoryAddress , u16 Copy_Count)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Channel < DMA_CHANNELS_COUNT) && (Copy_Count != 0) && (GET_BIT(DMA1->CH[Copy_Channel].CCR , DMA_CCR_EN) == 0) )
+    {
+        DMA1->CH[Copy_Channel].CPAR = Copy_PeripheralAddress;
+        DMA1->CH[Copy_Channel].CMAR = Copy_MemoryAddress;
+        DMA1->CH[Copy_Channel].CNDTR = Copy_Count;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_DMA_StartChannel(u8 Copy_Channel)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if (Copy_Channel < DMA_CHANNELS_COUNT)
+    {
+        SET_BIT(DMA1->CH[Copy_Channel].CCR , DMA_CCR_EN);
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_DMA_StopChannel(u8 Copy_Channel)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if (Copy_Channel < DMA_CHANNELS_COUNT)
+    {
+        CLR_BIT(DMA1->CH[Copy_Channel].CCR , DMA_CCR_EN);
+        DMA1->IFCR = ( (u32)DMA_ISR_CHANNEL_MASK << DMA_ISR_CHANNEL_SHIFT(Copy_Channel) );
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_DMA_GetRemainingCount(u8 Copy_Channel , u16 *Copy_RemainingCount)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Channel < DMA_CHANNELS_COUNT) && (Copy_RemainingCount != NULL) )
+    {
+        *Copy_RemainingCount = (u16)DMA1->CH[Copy_Channel].CNDTR;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_DMA_SetCallback(u8 Copy_Channel , u8 Copy_Event , DMA_CallbackFunc_t Copy_CallbackFunc)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Channel < DMA_CHANNELS_COUNT) && (Copy_Event < DMA_EVENTS_COUNT) )
+    {
+        DMA_Callback[Copy_Channel][Copy_Event] = Copy_CallbackFunc;
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+Std_ReturnType MCAL_DMA_SetCallbackMode(u8 Copy_Channel , u8 Copy_Mode)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if ( (Copy_Channel < DMA_CHANNELS_COUNT) && (Copy_Mode == DMA_CALLBACK_IMMEDIATE) )
+    {
+        CLR_BIT( DMA_DeferredChannels , Copy_Channel );
+        Local_FunctionStatus = E_OK;
+    }else if ( (Copy_Channel < DMA_CHANNELS_COUNT) && (Copy_Mode == DMA_CALLBACK_DEFERRED) )
+    {
+        SET_BIT( DMA_DeferredChannels , Copy_Channel );
+        Local_FunctionStatus = E_OK;
+    }else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+/**
+ * @brief Common body of the channel interrupts.
+ *
+ * Latches the channel flags, clears them with a single IFCR write and then runs the callbacks, error first.
+ * HT and TC can both be pending when the handler is late; they are reported in transfer order.
+ */
+static void DMA_voidChannelHandler(u8 Copy_Channel)
+{
+    u32 Local_Flags = ( DMA1->ISR >> DMA_ISR_CHANNEL_SHIFT(Copy_Channel) ) & DMA_ISR_CHANNEL_MASK;
+    DMA1->IFCR = ( Local_Flags << DMA_ISR_CHANNEL_SHIFT(Copy_Channel) );
+    if (GET_BIT(Local_Flags , DMA_ISR_TEIF))
+    {
+        DMA_voidRunCallback(Copy_Channel , DMA_EVENT_TRANSFER_ERROR);
+    }
+    if (GET_BIT(Local_Flags , DMA_ISR_HTIF))
+    {
+        DMA_voidRunCallback(Copy_Channel , DMA_EVENT_HALF_TRANSFER);
+    }
+    if (GET_BIT(Local_Flags , DMA_ISR_TCIF))
+    {
+        DMA_voidRunCallback(Copy_Channel , DMA_EVENT_TRANSFER_COMPLETE);
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+static void DMA_voidRunCallback(u8 Copy_Channel , u8 Copy_Event)
+{
+    DMA_CallbackFunc_t Local_Callback = DMA_Callback[Copy_Channel][Copy_Event];
+    if (Local_Callback != NULL)
+    {
+        if ( (GET_BIT(DMA_DeferredChannels , Copy_Channel) == 0) || (MCAL_SCB_PostDeferredCallback(Local_Callback) != E_OK) )
+        {
+            Local_Callback();
+        }
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DMA1_Channel1_IRQHandler(void)
+{
+    DMA_voidChannelHandler(DMA_CHANNEL1);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DMA1_Channel2_IRQHandler(void)
+{
+    DMA_voidChannelHandler(DMA_CHANNEL2);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DMA1_Channel3_IRQHandler(void)
+{
+    DMA_voidChannelHandler(DMA_CHANNEL3);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DMA1_Channel4_IRQHandler(void)
+{
+    DMA_voidChannelHandler(DMA_CHANNEL4);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DMA1_Channel5_IRQHandler(void)
+{
+    DMA_voidChannelHandler(DMA_CHANNEL5);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DMA1_Channel6_IRQHandler(void)
+{
+    DMA_voidChannelHandler(DMA_CHANNEL6);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+void DMA1_Channel7_IRQHandler(void)
+{
+    DMA_voidChannelHandler(DMA_CHANNEL7);
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   END_ FILE   ====================================================*/
@@ -0,0 +1,556 @@
+/**
+ * @brief This module contains functions for configuring and controlling General Purpose Input/Output (GPIO) pins.
+ *
+ * @author Mohamed Ali Bayoumi
+ * @date 6 oct 2023
+ * @version V01
+ *
+ * This module provides functions for configuring the mode, speed, and pull-up/down resistors of GPIO pins,
+ * as well as reading and writing their values. It is designed to be used with ARM Cortex-M processors, and may not be
+ * compatible with other architectures.
+ *
+ * @note This module is intended for use with the STM32F10x microcontroller series, but may be adapted for use with
+ * other compatible processors.
+ */
+
+
+/**************************************** LIB ******************************************************/
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+/**************************************** MCAL *****************************************************/
+#include "GPIO_interface.h"
+#include "GPIO_private.h"
+#include "GPIO_config.h"
+#include "SCB_interface.h"
+/**************************************** Global Var *****************************************************/
+/* Port register blocks indexed by GPIO_PORTA/B/C */
+static volatile GPIOx_t * const GPIO_PortTable[GPIO_PORTS_COUNT] = { MCAL_GPIOA, MCAL_GPIOB, MCAL_GPIOC };
+/* Debounced pins of each port, from GPIO_config.h */
+static const u16 GPIO_DebounceMask[GPIO_PORTS_COUNT] = { GPIO_DEBOUNCE_PORTA_MASK, GPIO_DEBOUNCE_PORTB_MASK, GPIO_DEBOUNCE_PORTC_MASK };
+static volatile GPIO_Debounce_t GPIO_Debounce[GPIO_PORTS_COUNT];
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_SetPinMode(u8 Copy_PortID , u8 Copy_PinID , u8 Copy_PinMode)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    switch (Copy_PortID)
+    {
+    case GPIO_PORTA:
+        if( Copy_PinID < 8 )
+        {
+            MCAL_GPIOA->CRL &= ~( (0b1111) << (Copy_PinID*4) );
+            MCAL_GPIOA->CRL |= ( (Copy_PinMode) << (Copy_PinID*4) );
+            Local_FunctionStatus = E_OK;
+        }else if ( Copy_PinID < 16)
+        {
+            Copy_PinID=Copy_PinID-8;
+            MCAL_GPIOA->CRH &= ~( (0b1111) << (Copy_PinID*4) );
+            MCAL_GPIOA->CRH |= ( (Copy_PinMode) << (Copy_PinID*4) );
+            Local_FunctionStatus = E_OK;
+        }
+        else
+        {
+            Local_FunctionStatus = E_NOT_OK;
+        }
+    break;
+    case GPIO_PORTB:
+        if( Copy_PinID < 8 )
+        {
+            MCAL_GPIOB->CRL &= ~( (0b1111) << (Copy_PinID*4) );
+            MCAL_GPIOB->CRL |= ( (Copy_PinMode) << (Copy_PinID*4) );
+            Local_FunctionStatus = E_OK;
+        }else if ( Copy_PinID < 16)
+        {
+            Copy_PinID=Copy_PinID-8;
+            MCAL_GPIOB->CRH &= ~( (0b1111) << (Copy_PinID*4) );
+            MCAL_GPIOB->CRH |= ( (Copy_PinMode) << (Copy_PinID*4) );
+            Local_FunctionStatus = E_OK;
+        }
+        else
+        {
+            Local_FunctionStatus = E_NOT_OK;
+        }
+    break;
+    case GPIO_PORTC:
+        if( Copy_PinID < 8 )
+        {
+            MCAL_GPIOC->CRL &= ~( (0b1111) << (Copy_PinID*4) );
+            MCAL_GPIOC->CRL |= ( (Copy_PinMode) << (Copy_PinID*4) );
+            Local_FunctionStatus = E_OK;
+        }else if ( Copy_PinID < 16)
+        {
+            Copy_PinID=Copy_PinID-8;
+            MCAL_GPIOC->CRH &= ~( (0b1111) << (Copy_PinID*4) );
+            MCAL_GPIOC->CRH |= ( (Copy_PinMode) << (Copy_PinID*4) );
+            Local_FunctionStatus = E_OK;
+        }
+        else
+        {
+            Local_FunctionStatus = E_NOT_OK;
+        }
+    break;
+    default:
+            Local_FunctionStatus = E_NOT_OK;
+    break;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_SetPinValue(u8 Copy_PortID , u8 Copy_PinID , u8 Copy_PinValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    switch (Copy_PortID)
+    {
+    case GPIO_PORTA:
+        switch (Copy_PinValue)
+        {
+        case GPIO_HIGH:
+            SET_BIT( (MCAL_GPIOA->ODR) , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        case GPIO_LOW:
+            CLR_BIT( (MCAL_GPIOA->ODR) , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+    break;
+    case GPIO_PORTB:
+        switch (Copy_PinValue)
+        {
+        case GPIO_HIGH:
+            SET_BIT(MCAL_GPIOB->ODR , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        case GPIO_LOW:
+            CLR_BIT(MCAL_GPIOB->ODR , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+    break;
+    case GPIO_PORTC:
+        switch (Copy_PinValue)
+        {
+        case GPIO_HIGH:
+            SET_BIT(MCAL_GPIOC->ODR , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        case GPIO_LOW:
+            CLR_BIT(MCAL_GPIOC->ODR , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+    break;
+    default:
+        Local_FunctionStatus = E_NOT_OK;
+        break;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_GetPinValue(u8 Copy_PortID , u8 Copy_PinID , u8 *Copy_PinReturnValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if(Copy_PinReturnValue != NULL){
+        switch (Copy_PortID)
+        {
+        case GPIO_PORTA:
+            *Copy_PinReturnValue = GET_BIT(MCAL_GPIOA->IDR , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        case GPIO_PORTB:
+            *Copy_PinReturnValue = GET_BIT(MCAL_GPIOB->IDR , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        case GPIO_PORTC:
+            *Copy_PinReturnValue = GET_BIT(MCAL_GPIOC->IDR , Copy_PinID);
+            Local_FunctionStatus = E_OK;
+            break;
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+    }
+    else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_AtomicSetPin(u8 Copy_PortID , u8 Copy_PinID )
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    switch (Copy_PortID)
+    {
+    case GPIO_PORTA:
+        SET_BIT(MCAL_GPIOA->BSRR , Copy_PinID);
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTB:
+        SET_BIT(MCAL_GPIOB->BSRR , Copy_PinID);
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTC:
+        SET_BIT(MCAL_GPIOC->BSRR , Copy_PinID);
+        Local_FunctionStatus = E_OK;
+        break;
+    default:
+        Local_FunctionStatus = E_NOT_OK;
+        break;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_AtomicResetPin(u8 Copy_PortID , u8 Copy_PinID )
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    switch (Copy_PortID)
+    {
+    case GPIO_PORTA:
+        SET_BIT(MCAL_GPIOA->BRR , Copy_PinID);
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTB:
+        SET_BIT(MCAL_GPIOB->BRR , Copy_PinID);
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTC:
+        SET_BIT(MCAL_GPIOC->BRR , Copy_PinID);
+        Local_FunctionStatus = E_OK;
+        break;
+    default:
+        Local_FunctionStatus = E_NOT_OK;
+        break;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+
+Std_ReturnType MCAL_GPIO_LCKPin(u8 Copy_PortID , u8 Copy_PinID ,u8 Copy_PinState)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    switch (Copy_PortID)
+    {
+    case GPIO_PORTA:
+        if(Copy_PinState == GPIO_LOCKED)
+        {SET_BIT(MCAL_GPIOA->LCKR , Copy_PinID);}
+        else if( Copy_PinState == GPIO_UNLOCKED)
+        {CLR_BIT(MCAL_GPIOA -> LCKR , Copy_PinID);}
+        SET_BIT(MCAL_GPIOA->LCKR , LCKK);
+        CLR_BIT(MCAL_GPIOA->LCKR , LCKK);
+        SET_BIT(MCAL_GPIOA->LCKR , LCKK);
+        while(!GET_BIT(MCAL_GPIOA->LCKR , LCKK));
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTB:
+        if(Copy_PinState == GPIO_LOCKED)
+        {SET_BIT(MCAL_GPIOB->LCKR , Copy_PinID);}
+        else if(Copy_PinState == GPIO_UNLOCKED)
+        {CLR_BIT(MCAL_GPIOB->LCKR , Copy_PinID);}
+        SET_BIT(MCAL_GPIOB->LCKR , LCKK);
+        CLR_BIT(MCAL_GPIOB->LCKR , LCKK);
+        SET_BIT(MCAL_GPIOB->LCKR , LCKK);
+        while(!GET_BIT(MCAL_GPIOB->LCKR , LCKK));
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTC:
+        if(Copy_PinState == GPIO_LOCKED)
+        {SET_BIT(MCAL_GPIOC->LCKR , Copy_PinID);}
+        else if(Copy_PinState == GPIO_UNLOCKED)
+        {CLR_BIT(MCAL_GPIOC->LCKR , Copy_PinID);}
+        SET_BIT(MCAL_GPIOC->LCKR , LCKK);
+        CLR_BIT(MCAL_GPIOC->LCKR , LCKK);
+        SET_BIT(MCAL_GPIOC->LCKR , LCKK);
+        while(!GET_BIT(MCAL_GPIOC->LCKR , LCKK));
+        Local_FunctionStatus = E_OK;
+        break;
+    default:
+        Local_FunctionStatus = E_NOT_OK;
+        break;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_SetPortValueMasked(u8 Copy_PortID , u16 Copy_Mask , u16 Copy_Value)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    /* BS bits in the low half set pins, BR bits in the high half reset them, both in one store */
+    u32 Local_BSRRValue = ( (u32)(~Copy_Value & Copy_Mask) << GPIO_BSRR_RESET_SHIFT ) | (u32)(Copy_Value & Copy_Mask);
+    switch (Copy_PortID)
+    {
+    case GPIO_PORTA:
+        MCAL_GPIOA->BSRR = Local_BSRRValue;
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTB:
+        MCAL_GPIOB->BSRR = Local_BSRRValue;
+        Local_FunctionStatus = E_OK;
+        break;
+    case GPIO_PORTC:
+        MCAL_GPIOC->BSRR = Local_BSRRValue;
+        Local_FunctionStatus = E_OK;
+        break;
+    default:
+        Local_FunctionStatus = E_NOT_OK;
+        break;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_GetPortValueMasked(u8 Copy_PortID , u16 Copy_Mask , u16 *Copy_PortReturnValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if(Copy_PortReturnValue != NULL){
+        switch (Copy_PortID)
+        {
+        case GPIO_PORTA:
+            *Copy_PortReturnValue = (u16)(MCAL_GPIOA->IDR & Copy_Mask);
+            Local_FunctionStatus = E_OK;
+            break;
+        case GPIO_PORTB:
+            *Copy_PortReturnValue = (u16)(MCAL_GPIOB->IDR & Copy_Mask);
+            Local_FunctionStatus = E_OK;
+            break;
+        case GPIO_PORTC:
+            *Copy_PortReturnValue = (u16)(MCAL_GPIOC->IDR & Copy_Mask);
+            Local_FunctionStatus = E_OK;
+            break;
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+    }
+    else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_ApplyConfigTable(const GPIO_PinCfg_t *Copy_PinCfgTable , u8 Copy_PinCfgCount)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    /* Bits of CRL/CRH touched by the table and their new contents, per port */
+    u32 Local_CRMask[GPIO_PORTS_COUNT][2]  = { {0} };
+    u32 Local_CRValue[GPIO_PORTS_COUNT][2] = { {0} };
+    /* Pins whose ODR level is set by the table and their levels, per port */
+    u16 Local_ODRMask[GPIO_PORTS_COUNT]    = { 0 };
+    u16 Local_ODRValue[GPIO_PORTS_COUNT]   = { 0 };
+    u8 Local_Index, Local_Port, Local_Reg, Local_Shift;
+    volatile GPIOx_t *Local_GPIOx;
+
+    if( Copy_PinCfgTable != NULL )
+    {
+        Local_FunctionStatus = E_OK;
+        /* Fold the whole table first so an invalid entry leaves the hardware untouched */
+        for( Local_Index = 0; Local_Index < Copy_PinCfgCount; Local_Index++ )
+        {
+            const GPIO_PinCfg_t *Local_Cfg = &Copy_PinCfgTable[Local_Index];
+            if( (Local_Cfg->PortID >= GPIO_PORTS_COUNT) || (Local_Cfg->PinID > GPIO_PIN15) ||
+                (Local_Cfg->PinMode > 0b1111) || (Local_Cfg->PinValue > GPIO_HIGH) )
+            {
+                Local_FunctionStatus = E_NOT_OK;
+                break;
+            }
+            Local_Port  = Local_Cfg->PortID;
+            Local_Reg   = Local_Cfg->PinID >> 3;            /* 0: CRL, 1: CRH */
+            Local_Shift = (Local_Cfg->PinID & 0x07) * 4;
+            Local_CRMask[Local_Port][Local_Reg]  |=  ( (u32)0b1111 << Local_Shift );
+            Local_CRValue[Local_Port][Local_Reg] &= ~( (u32)0b1111 << Local_Shift );
+            Local_CRValue[Local_Port][Local_Reg] |=  ( (u32)Local_Cfg->PinMode << Local_Shift );
+            Local_ODRMask[Local_Port] |= (u16)( 1U << Local_Cfg->PinID );
+            if( Local_Cfg->PinValue == GPIO_HIGH )
+            {
+                Local_ODRValue[Local_Port] |=  (u16)( 1U << Local_Cfg->PinID );
+            }
+            else
+            {
+                Local_ODRValue[Local_Port] &= (u16)~( 1U << Local_Cfg->PinID );
+            }
+        }
+        if( Local_FunctionStatus == E_OK )
+        {
+            /* Commit: one BSRR, one CRL and one CRH write per port, skipping untouched registers */
+            for( Local_Port = 0; Local_Port < GPIO_PORTS_COUNT; Local_Port++ )
+            {
+                Local_GPIOx = GPIO_PortTable[Local_Port];
+                if( Local_ODRMask[Local_Port] != 0 )
+                {
+                    Local_GPIOx->BSRR = ( (u32)(~Local_ODRValue[Local_Port] & Local_ODRMask[Local_Port]) << GPIO_BSRR_RESET_SHIFT ) |
+                                        (u32)(Local_ODRValue[Local_Port] & Local_ODRMask[Local_Port]);
+                }
+                if( Local_CRMask[Local_Port][0] != 0 )
+                {
+                    Local_GPIOx->CRL = ( Local_GPIOx->CRL & ~Local_CRMask[Local_Port][0] ) | Local_CRValue[Local_Port][0];
+                }
+                if( Local_CRMask[Local_Port][1] != 0 )
+                {
+                    Local_GPIOx->CRH = ( Local_GPIOx->CRH & ~Local_CRMask[Local_Port][1] ) | Local_CRValue[Local_Port][1];
+                }
+            }
+        }
+    }
+    else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_DebounceInit(void)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u8 Local_Port;
+    for( Local_Port = 0; Local_Port < GPIO_PORTS_COUNT; Local_Port++ )
+    {
+        GPIO_Debounce[Local_Port].State   = (u16)( GPIO_PortTable[Local_Port]->IDR & GPIO_DebounceMask[Local_Port] );
+        GPIO_Debounce[Local_Port].Cnt0    = 0;
+        GPIO_Debounce[Local_Port].Cnt1    = 0;
+        GPIO_Debounce[Local_Port].Rising  = 0;
+        GPIO_Debounce[Local_Port].Falling = 0;
+    }
+    Local_FunctionStatus = E_OK;
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+void MCAL_GPIO_DebounceTick(void)
+{
+    u8 Local_Port;
+    u16 Local_Delta, Local_Toggle, Local_Cnt0, Local_Cnt1, Local_State;
+    for( Local_Port = 0; Local_Port < GPIO_PORTS_COUNT; Local_Port++ )
+    {
+        if( GPIO_DebounceMask[Local_Port] != 0 )
+        {
+            Local_State = GPIO_Debounce[Local_Port].State;
+            /* Pins whose sample differs from the debounced state */
+            Local_Delta = (u16)( ( GPIO_PortTable[Local_Port]->IDR & GPIO_DebounceMask[Local_Port] ) ^ Local_State );
+            /* Count up the 2-bit counters of differing pins, reset the others to 0 */
+            Local_Cnt1  = (u16)( ( GPIO_Debounce[Local_Port].Cnt1 ^ GPIO_Debounce[Local_Port].Cnt0 ) & Local_Delta );
+            Local_Cnt0  = (u16)( ~GPIO_Debounce[Local_Port].Cnt0 & Local_Delta );
+            /* A counter that wrapped back to 0 while still differing has seen GPIO_DEBOUNCE_SAMPLES samples */
+            Local_Toggle = (u16)( Local_Delta & ~( Local_Cnt0 | Local_Cnt1 ) );
+            Local_State ^= Local_Toggle;
+
+            GPIO_Debounce[Local_Port].Cnt0     = Local_Cnt0;
+            GPIO_Debounce[Local_Port].Cnt1     = Local_Cnt1;
+            GPIO_Debounce[Local_Port].State    = Local_State;
+            GPIO_Debounce[Local_Port].Rising  |= (u16)( Local_Toggle & Local_State );
+            GPIO_Debounce[Local_Port].Falling |= (u16)( Local_Toggle & ~Local_State );
+        }
+    }
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_DebounceGetState(u8 Copy_PortID , u16 *Copy_StateReturnValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if( (Copy_StateReturnValue != NULL) && (Copy_PortID < GPIO_PORTS_COUNT) )
+    {
+        *Copy_StateReturnValue = GPIO_Debounce[Copy_PortID].State;
+        Local_FunctionStatus = E_OK;
+    }
+    else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_DebounceGetEdges(u8 Copy_PortID , u16 *Copy_RisingReturnValue , u16 *Copy_FallingReturnValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    u8 Local_CriticalState;
+    u16 Local_Rising, Local_Falling;
+    if( Copy_PortID < GPIO_PORTS_COUNT )
+    {
+        /* The tick may run from an interrupt: read and clear in one step */
+        MCAL_SCB_EnterCritical(&Local_CriticalState);
+        Local_Rising  = GPIO_Debounce[Copy_PortID].Rising;
+        Local_Falling = GPIO_Debounce[Copy_PortID].Falling;
+        GPIO_Debounce[Copy_PortID].Rising  = 0;
+        GPIO_Debounce[Copy_PortID].Falling = 0;
+        MCAL_SCB_ExitCritical(Local_CriticalState);
+        if( Copy_RisingReturnValue != NULL )
+        {
+            *Copy_RisingReturnValue = Local_Rising;
+        }
+        if( Copy_FallingReturnValue != NULL )
+        {
+            *Copy_FallingReturnValue = Local_Falling;
+        }
+        Local_FunctionStatus = E_OK;
+    }
+    else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   Start_FUNCTION   ====================================================*/
+
+Std_ReturnType MCAL_GPIO_GetPortRegAddress(u8 Copy_PortID , u8 Copy_RegID , u32 *Copy_AddressReturnValue)
+{
+    Std_ReturnType Local_FunctionStatus = E_NOT_OK;
+    if( (Copy_PortID < GPIO_PORTS_COUNT) && (Copy_AddressReturnValue != NULL) )
+    {
+        Local_FunctionStatus = E_OK;
+        switch (Copy_RegID)
+        {
+        case GPIO_REG_IDR:
+            *Copy_AddressReturnValue = (u32)&GPIO_PortTable[Copy_PortID]->IDR;
+            break;
+        case GPIO_REG_ODR:
+            *Copy_AddressReturnValue = (u32)&GPIO_PortTable[Copy_PortID]->ODR;
+            break;
+        case GPIO_REG_BSRR:
+            *Copy_AddressReturnValue = (u32)&GPIO_PortTable[Copy_PortID]->BSRR;
+            break;
+        case GPIO_REG_BRR:
+            *Copy_AddressReturnValue = (u32)&GPIO_PortTable[Copy_PortID]->BRR;
+            break;
+        default:
+            Local_FunctionStatus = E_NOT_OK;
+            break;
+        }
+    }
+    else
+    {
+        Local_FunctionStatus = E_NOT_OK;
+    }
+    return Local_FunctionStatus;
+}
+/*====================================================   END_FUNCTION   ====================================================*/
+/*====================================================   END_ FILE   ====================================================*/
@@ -0,0 +1,41 @@
+/**
+ ******************************************************************************
+ * @file           : main.c
+ * @brief          : Quadrature encoder test
+ ******************************************************************************
+ * Encoder A/B on PA0/PA1 (TIM2 CH1/CH2), counted by TIM2 in x4 mode.
+ * TIM3 latches the time of every A edge through TIM2 TRGO -> TIM3 ITR1,
+ * for the low speed velocity. TIM2_IRQHandler extends the position.
+ ******************************************************************************
+ */
+#include "STD_TYPES.h"
+#include "BIT_MATH.h"
+#include "STM32F103C8.h"
+#include "RCC_interface.h"
+#include "GPIO_interface.h"
+#include "NVIC_interface.h"
+#include "GPT_interface.h"
+
+int main(void)
+{
+	s32 Position=0;
+	s32 Velocity=0;
+	/*CLK INIT*/
+	MCAL_RCC_InitSysClock();
+	MCAL_Rcc_EnablePrephiral(RCC_APB2_IOPAEN, RCC_APB2);
+	MCAL_Rcc_EnablePrephiral(RCC_APB1_TIM2EN, RCC_APB1);
+	MCAL_Rcc_EnablePrephiral(RCC_APB1_TIM3EN, RCC_APB1);
+	/*ENCODER PINS*/
+	MCAL_GPIO_SetPinMode(GPIO_PORTA, GPIO_PIN0, GPIO_INPUT_FLOATING_MODE);
+	MCAL_GPIO_SetPinMode(GPIO_PORTA, GPIO_PIN1, GPIO_INPUT_FLOATING_MODE);
+	/*TIM 2 ENCODER, TIM 3 TIMESTAMPS*/
+	GPT_Encoder_Config_t Encoder_Config={TIM_ENCODER_X4,Rising,Rising,3,TIM3};
+	GPT_Encoder_INIT(TIM2,&Encoder_Config);
+	MCAL_NVIC_EnableIRQ(NVIC_TIM2_IRQn);
+	/* Loop forever */
+	for(;;)
+	{
+		GPT_Encoder_GetPosition(TIM2,&Position);
+		GPT_Encoder_GetVelocity(TIM2,&Velocity);
+	}
+}